@@ -36,21 +36,26 @@
 
 struct target_psoc_info;
 
-typedef const enum policy_mgr_pcl_type
+/*
+ * The concurrency tables hold enum policy_mgr_pcl_type and
+ * enum policy_mgr_conc_next_action values packed in a byte per entry
+ * rather than an int sized enum, which keeps them a quarter of the size.
+ */
+typedef const uint8_t
 	pm_dbs_pcl_second_connection_table_type
 	[PM_MAX_ONE_CONNECTION_MODE][PM_MAX_NUM_OF_MODE]
 	[PM_MAX_CONC_PRIORITY_MODE];
 
-typedef const enum policy_mgr_pcl_type
+typedef const uint8_t
 	pm_dbs_pcl_third_connection_table_type
 	[PM_MAX_TWO_CONNECTION_MODE][PM_MAX_NUM_OF_MODE]
 	[PM_MAX_CONC_PRIORITY_MODE];
 
-typedef const enum policy_mgr_conc_next_action
+typedef const uint8_t
 	policy_mgr_next_action_two_connection_table_type
 	[PM_MAX_ONE_CONNECTION_MODE][POLICY_MGR_MAX_BAND];
 
-typedef const enum policy_mgr_conc_next_action
+typedef const uint8_t
 	policy_mgr_next_action_three_connection_table_type
 	[PM_MAX_TWO_CONNECTION_MODE][POLICY_MGR_MAX_BAND];
 
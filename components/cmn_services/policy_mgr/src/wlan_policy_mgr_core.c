@@ -570,6 +570,59 @@ QDF_STATUS policy_mgr_get_old_and_new_hw_index(
 	return QDF_STATUS_SUCCESS;
 }
 
+void policy_mgr_publish_conn_summary(struct policy_mgr_psoc_priv_obj *pm_ctx)
+{
+	struct policy_mgr_conn_summary *summary;
+	struct policy_mgr_conc_connection_info *conn;
+	uint32_t seq, conn_index;
+	uint8_t band;
+
+	seq = qdf_atomic_read(&pm_ctx->conn_summary_seq);
+	summary = &pm_ctx->conn_summary[(seq + 1) & 1];
+	qdf_mem_zero(summary, sizeof(*summary));
+
+	for (conn_index = 0; conn_index < MAX_NUMBER_OF_CONC_CONNECTIONS;
+	     conn_index++) {
+		conn = &pm_conc_connection_list[conn_index];
+		if (!conn->in_use || conn->mode >= PM_MAX_NUM_OF_MODE)
+			continue;
+
+		if (conn->freq <= WLAN_REG_MAX_24GHZ_CHAN_FREQ)
+			band = BIT(REG_BAND_2G);
+		else if (WLAN_REG_IS_6GHZ_CHAN_FREQ(conn->freq))
+			band = BIT(REG_BAND_6G);
+		else if (conn->freq >= WLAN_REG_MIN_5GHZ_CHAN_FREQ)
+			band = BIT(REG_BAND_5G);
+		else
+			band = 0;
+
+		summary->mode_index[conn->mode]
+				   [summary->mode_count[conn->mode]++] =
+			conn_index;
+		summary->mode_band_mask[conn->mode] |= band;
+		summary->vdev_id[conn_index] = conn->vdev_id;
+		summary->num_conn++;
+	}
+
+	/* summary must be complete before readers are switched to it */
+	qdf_mb();
+	qdf_atomic_inc(&pm_ctx->conn_summary_seq);
+}
+
+void policy_mgr_get_conn_summary(struct policy_mgr_psoc_priv_obj *pm_ctx,
+				 struct policy_mgr_conn_summary *summary)
+{
+	uint32_t seq;
+
+	do {
+		seq = qdf_atomic_read(&pm_ctx->conn_summary_seq);
+		qdf_mb();
+		qdf_mem_copy(summary, &pm_ctx->conn_summary[seq & 1],
+			     sizeof(*summary));
+		qdf_mb();
+	} while (seq != qdf_atomic_read(&pm_ctx->conn_summary_seq));
+}
+
 void policy_mgr_update_conc_list(struct wlan_objmgr_psoc *psoc,
 		uint32_t conn_index,
 		enum policy_mgr_con_mode mode,
@@ -608,6 +661,7 @@ void policy_mgr_update_conc_list(struct wlan_objmgr_psoc *psoc,
 	pm_conc_connection_list[conn_index].vdev_id = vdev_id;
 	pm_conc_connection_list[conn_index].in_use = in_use;
 	pm_conc_connection_list[conn_index].ch_flagext = ch_flagext;
+	policy_mgr_publish_conn_summary(pm_ctx);
 	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
 
 	/*
@@ -842,6 +896,7 @@ void policy_mgr_restore_deleted_conn_info(struct wlan_objmgr_psoc *psoc,
 
 	qdf_mem_copy(&pm_conc_connection_list[conn_index], info,
 			num_cxn_del * sizeof(*info));
+	policy_mgr_publish_conn_summary(pm_ctx);
 	pm_ctx->no_of_active_sessions[info->mode] += num_cxn_del;
 	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
 
@@ -3467,6 +3522,7 @@ QDF_STATUS policy_mgr_reset_sap_mandatory_channels(
 	qdf_mem_zero(pm_ctx->sap_mandatory_channels,
 		     QDF_ARRAY_SIZE(pm_ctx->sap_mandatory_channels) *
 		     sizeof(*pm_ctx->sap_mandatory_channels));
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -3494,6 +3550,7 @@ void policy_mgr_add_sap_mandatory_chan(struct wlan_objmgr_psoc *psoc,
 	policy_mgr_debug("Ch freq: %hu", ch_freq);
 	pm_ctx->sap_mandatory_channels[pm_ctx->sap_mandatory_channels_len++]
 		= ch_freq;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 }
 
 uint32_t policy_mgr_get_sap_mandatory_chan_list_len(
@@ -3562,6 +3619,7 @@ void  policy_mgr_add_sap_mandatory_6ghz_chan(struct wlan_objmgr_psoc *psoc)
 				ch_freq_list[i];
 		}
 	}
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 }
 #else
 static inline
@@ -3611,6 +3669,7 @@ policy_mgr_init_sap_mandatory_chan_by_band(struct wlan_objmgr_psoc *psoc,
 				ch_freq_list[i];
 		}
 	}
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 	if (band_bitmap & BIT(REG_BAND_5G))
 		policy_mgr_add_sap_mandatory_chan(psoc,
 						  SAP_MANDATORY_5G_CH_FREQ);
@@ -3672,4 +3731,5 @@ void policy_mgr_remove_sap_mandatory_chan(struct wlan_objmgr_psoc *psoc,
 	qdf_mem_copy(pm_ctx->sap_mandatory_channels, ch_freq_list,
 		     num_chan * sizeof(*pm_ctx->sap_mandatory_channels));
 	pm_ctx->sap_mandatory_channels_len = num_chan;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 }
@@ -86,6 +86,7 @@ QDF_STATUS policy_mgr_set_dual_mac_feature(struct wlan_objmgr_psoc *psoc,
 	}
 
 	pm_ctx->cfg.dual_mac_feature = dual_mac_feature;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -132,6 +133,7 @@ policy_mgr_set_sta_sap_scc_on_dfs_chnl(struct wlan_objmgr_psoc *psoc,
 		return QDF_STATUS_E_FAILURE;
 	}
 	pm_ctx->cfg.sta_sap_scc_on_dfs_chnl = sta_sap_scc_on_dfs_chnl;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -207,6 +209,7 @@ policy_mgr_update_dfs_master_dynamic_enabled(
 		enable = false;
 end:
 	pm_ctx->dynamic_dfs_master_disabled = !enable;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 	if (!enable)
 		policy_mgr_debug("sta_sap_scc_on_dfs_chnl %d sta_on_2g %d sta_on_5g %d enable %d",
 				 pm_ctx->cfg.sta_sap_scc_on_dfs_chnl, sta_on_2g,
@@ -393,6 +396,7 @@ QDF_STATUS policy_mgr_set_ch_select_plcy(struct wlan_objmgr_psoc *psoc,
 		return QDF_STATUS_E_FAILURE;
 	}
 	pm_ctx->cfg.chnl_select_plcy = ch_select_policy;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -802,6 +806,7 @@ void policy_mgr_init_dbs_config(struct wlan_objmgr_psoc *psoc,
 	}
 	pm_ctx->dual_mac_cfg.cur_scan_config = 0;
 	pm_ctx->dual_mac_cfg.cur_fw_mode_config = 0;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	dual_mac_feature = pm_ctx->cfg.dual_mac_feature;
 	/* If dual mac features are disabled in the INI, we
@@ -882,6 +887,7 @@ void policy_mgr_update_dbs_fw_config(struct wlan_objmgr_psoc *psoc)
 		pm_ctx->dual_mac_cfg.cur_fw_mode_config;
 	pm_ctx->dual_mac_cfg.cur_fw_mode_config =
 		pm_ctx->dual_mac_cfg.req_fw_mode_config;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 }
 
 void policy_mgr_update_dbs_req_config(struct wlan_objmgr_psoc *psoc,
@@ -1390,54 +1396,43 @@ bool policy_mgr_is_2x2_2G_1x1_5G_dbs_capable(struct wlan_objmgr_psoc *psoc)
 
 uint32_t policy_mgr_get_connection_count(struct wlan_objmgr_psoc *psoc)
 {
-	uint32_t conn_index, count = 0;
+	struct policy_mgr_conn_summary summary;
 	struct policy_mgr_psoc_priv_obj *pm_ctx;
 
 	pm_ctx = policy_mgr_get_context(psoc);
 	if (!pm_ctx) {
 		policy_mgr_err("Invalid Context");
-		return count;
+		return 0;
 	}
 
-	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
-	for (conn_index = 0; conn_index < MAX_NUMBER_OF_CONC_CONNECTIONS;
-		conn_index++) {
-		if (pm_conc_connection_list[conn_index].in_use)
-			count++;
-	}
-	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
+	policy_mgr_get_conn_summary(pm_ctx, &summary);
 
-	return count;
+	return summary.num_conn;
 }
 
 uint32_t policy_mgr_mode_specific_vdev_id(struct wlan_objmgr_psoc *psoc,
 					  enum policy_mgr_con_mode mode)
 {
-	uint32_t conn_index = 0;
-	uint32_t vdev_id = WLAN_INVALID_VDEV_ID;
+	struct policy_mgr_conn_summary summary;
 	struct policy_mgr_psoc_priv_obj *pm_ctx;
 
 	pm_ctx = policy_mgr_get_context(psoc);
 	if (!pm_ctx) {
 		policy_mgr_err("Invalid Context");
-		return vdev_id;
+		return WLAN_INVALID_VDEV_ID;
 	}
-	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
+	if (mode >= PM_MAX_NUM_OF_MODE)
+		return WLAN_INVALID_VDEV_ID;
+
+	policy_mgr_get_conn_summary(pm_ctx, &summary);
 	/*
 	 * Note: This gives you the first vdev id of the mode type in a
 	 * sta+sta or sap+sap or p2p + p2p case
 	 */
-	for (conn_index = 0; conn_index < MAX_NUMBER_OF_CONC_CONNECTIONS;
-		conn_index++) {
-		if ((pm_conc_connection_list[conn_index].mode == mode) &&
-			pm_conc_connection_list[conn_index].in_use) {
-			vdev_id = pm_conc_connection_list[conn_index].vdev_id;
-			break;
-		}
-	}
-	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
+	if (!summary.mode_count[mode])
+		return WLAN_INVALID_VDEV_ID;
 
-	return vdev_id;
+	return summary.vdev_id[summary.mode_index[mode][0]];
 }
 
 uint32_t policy_mgr_mode_specific_connection_count(
@@ -1445,54 +1440,49 @@ uint32_t policy_mgr_mode_specific_connection_count(
 		enum policy_mgr_con_mode mode,
 		uint32_t *list)
 {
-	uint32_t conn_index = 0, count = 0;
+	struct policy_mgr_conn_summary summary;
 	struct policy_mgr_psoc_priv_obj *pm_ctx;
+	uint32_t i;
 
 	pm_ctx = policy_mgr_get_context(psoc);
 	if (!pm_ctx) {
 		policy_mgr_err("Invalid Context");
-		return count;
-	}
-	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
-	for (conn_index = 0; conn_index < MAX_NUMBER_OF_CONC_CONNECTIONS;
-		conn_index++) {
-		if ((pm_conc_connection_list[conn_index].mode == mode) &&
-			pm_conc_connection_list[conn_index].in_use) {
-			if (list)
-				list[count] = conn_index;
-			 count++;
-		}
+		return 0;
 	}
-	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
+	if (mode >= PM_MAX_NUM_OF_MODE)
+		return 0;
 
-	return count;
+	policy_mgr_get_conn_summary(pm_ctx, &summary);
+	if (list)
+		for (i = 0; i < summary.mode_count[mode]; i++)
+			list[i] = summary.mode_index[mode][i];
+
+	return summary.mode_count[mode];
 }
 
 QDF_STATUS policy_mgr_check_conn_with_mode_and_vdev_id(
 		struct wlan_objmgr_psoc *psoc, enum policy_mgr_con_mode mode,
 		uint32_t vdev_id)
 {
-	QDF_STATUS qdf_status = QDF_STATUS_E_FAILURE;
-	uint32_t conn_index = 0;
+	struct policy_mgr_conn_summary summary;
 	struct policy_mgr_psoc_priv_obj *pm_ctx;
+	uint32_t i;
 
 	pm_ctx = policy_mgr_get_context(psoc);
 	if (!pm_ctx) {
 		policy_mgr_err("Invalid Context");
-		return qdf_status;
+		return QDF_STATUS_E_FAILURE;
 	}
+	if (mode >= PM_MAX_NUM_OF_MODE)
+		return QDF_STATUS_E_FAILURE;
 
-	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
-	while (PM_CONC_CONNECTION_LIST_VALID_INDEX(conn_index)) {
-		if ((pm_conc_connection_list[conn_index].mode == mode) &&
-		    (pm_conc_connection_list[conn_index].vdev_id == vdev_id)) {
-			qdf_status = QDF_STATUS_SUCCESS;
-			break;
-		}
-		conn_index++;
+	policy_mgr_get_conn_summary(pm_ctx, &summary);
+	for (i = 0; i < summary.mode_count[mode]; i++) {
+		if (summary.vdev_id[summary.mode_index[mode][i]] == vdev_id)
+			return QDF_STATUS_SUCCESS;
 	}
-	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
-	return qdf_status;
+
+	return QDF_STATUS_E_FAILURE;
 }
 
 void policy_mgr_soc_set_dual_mac_cfg_cb(enum set_hw_mode_status status,
@@ -2175,6 +2165,7 @@ QDF_STATUS policy_mgr_decr_connection_count(struct wlan_objmgr_psoc *psoc,
 	/* clean up the entry */
 	qdf_mem_zero(&pm_conc_connection_list[next_conn_index - 1],
 		sizeof(*pm_conc_connection_list));
+	policy_mgr_publish_conn_summary(pm_ctx);
 	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
 
 	return QDF_STATUS_SUCCESS;
@@ -2829,6 +2820,7 @@ QDF_STATUS policy_mgr_set_user_cfg(struct wlan_objmgr_psoc *psoc,
 	}
 
 	pm_ctx->user_cfg = *user_cfg;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 	policy_mgr_debug("dbs_selection_plcy 0x%x",
 			 pm_ctx->cfg.dbs_selection_plcy);
 	policy_mgr_debug("vdev_priority_list 0x%x",
@@ -4080,52 +4072,37 @@ bool policy_mgr_is_sta_sap_scc_allowed_on_dfs_chan(
 bool policy_mgr_is_special_mode_active_5g(struct wlan_objmgr_psoc *psoc,
 					  enum policy_mgr_con_mode mode)
 {
+	struct policy_mgr_conn_summary summary;
 	struct policy_mgr_psoc_priv_obj *pm_ctx;
-	uint32_t conn_index;
-	bool ret = false;
 
 	pm_ctx = policy_mgr_get_context(psoc);
 	if (!pm_ctx) {
 		policy_mgr_err("Invalid Context");
-		return ret;
-	}
-	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
-	for (conn_index = 0; conn_index < MAX_NUMBER_OF_CONC_CONNECTIONS;
-	     conn_index++) {
-		if (pm_conc_connection_list[conn_index].mode == mode &&
-		    pm_conc_connection_list[conn_index].freq >=
-					WLAN_REG_MIN_5GHZ_CHAN_FREQ &&
-		    pm_conc_connection_list[conn_index].in_use)
-			ret = true;
+		return false;
 	}
-	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
+	if (mode >= PM_MAX_NUM_OF_MODE)
+		return false;
 
-	return ret;
+	policy_mgr_get_conn_summary(pm_ctx, &summary);
+
+	return !!(summary.mode_band_mask[mode] &
+		  (BIT(REG_BAND_5G) | BIT(REG_BAND_6G)));
 }
 
 bool policy_mgr_is_sta_connected_2g(struct wlan_objmgr_psoc *psoc)
 {
+	struct policy_mgr_conn_summary summary;
 	struct policy_mgr_psoc_priv_obj *pm_ctx;
-	uint32_t conn_index;
-	bool ret = false;
 
 	pm_ctx = policy_mgr_get_context(psoc);
 	if (!pm_ctx) {
 		policy_mgr_err("Invalid Context");
-		return ret;
-	}
-	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
-	for (conn_index = 0; conn_index < MAX_NUMBER_OF_CONC_CONNECTIONS;
-	     conn_index++) {
-		if (pm_conc_connection_list[conn_index].mode == PM_STA_MODE &&
-		    pm_conc_connection_list[conn_index].freq <=
-				WLAN_REG_MAX_24GHZ_CHAN_FREQ &&
-		    pm_conc_connection_list[conn_index].in_use)
-			ret = true;
+		return false;
 	}
-	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
 
-	return ret;
+	policy_mgr_get_conn_summary(pm_ctx, &summary);
+
+	return !!(summary.mode_band_mask[PM_STA_MODE] & BIT(REG_BAND_2G));
 }
 
 uint32_t policy_mgr_get_connection_info(struct wlan_objmgr_psoc *psoc,
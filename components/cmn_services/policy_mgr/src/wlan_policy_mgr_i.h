@@ -23,6 +23,7 @@
 #include "qdf_event.h"
 #include "qdf_mc_timer.h"
 #include "qdf_lock.h"
+#include "qdf_atomic.h"
 #include "qdf_defer.h"
 #include "wlan_reg_services_api.h"
 #include "cds_ieee80211_common_i.h"
@@ -193,18 +194,18 @@
 extern struct policy_mgr_conc_connection_info
 	pm_conc_connection_list[MAX_NUMBER_OF_CONC_CONNECTIONS];
 
-extern const enum policy_mgr_pcl_type
+extern const uint8_t
 	first_connection_pcl_table[PM_MAX_NUM_OF_MODE]
 			[PM_MAX_CONC_PRIORITY_MODE];
 extern  pm_dbs_pcl_second_connection_table_type
 	*second_connection_pcl_dbs_table;
 
-extern enum policy_mgr_pcl_type const
+extern uint8_t const
 	(*second_connection_pcl_non_dbs_table)[PM_MAX_ONE_CONNECTION_MODE]
 			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE];
 extern pm_dbs_pcl_third_connection_table_type
 		*third_connection_pcl_dbs_table;
-extern enum policy_mgr_pcl_type const
+extern uint8_t const
 	(*third_connection_pcl_non_dbs_table)[PM_MAX_TWO_CONNECTION_MODE]
 			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE];
 
@@ -214,7 +215,7 @@ extern policy_mgr_next_action_three_connection_table_type
 		*next_action_three_connection_table;
 
 #ifdef FEATURE_FOURTH_CONNECTION
-extern const enum policy_mgr_pcl_type
+extern const uint8_t
 	fourth_connection_pcl_dbs_table
 	[PM_MAX_THREE_CONNECTION_MODE][PM_MAX_NUM_OF_MODE]
 	[PM_MAX_CONC_PRIORITY_MODE];
@@ -277,6 +278,46 @@ struct policy_mgr_cfg {
 	enum policy_mgr_pcl_band_priority pcl_band_priority;
 };
 
+/**
+ * struct policy_mgr_pcl_cache_entry - PCL last computed for a connection mode
+ * @valid: entry holds a computed PCL
+ * @gen: pcl_cache_gen the PCL was computed at
+ * @pcl: PCL type picked from the concurrency tables
+ * @weight_len: size of the weight list the PCL was computed for
+ * @conn: connection table the PCL was computed for
+ * @len: number of channels in @ch_freq
+ * @ch_freq: PCL channel frequency list
+ * @weight: PCL channel weight list
+ */
+struct policy_mgr_pcl_cache_entry {
+	bool valid;
+	uint32_t gen;
+	enum policy_mgr_pcl_type pcl;
+	uint32_t weight_len;
+	struct policy_mgr_conc_connection_info
+		conn[MAX_NUMBER_OF_CONC_CONNECTIONS];
+	uint32_t len;
+	uint32_t ch_freq[NUM_CHANNELS];
+	uint8_t weight[NUM_CHANNELS];
+};
+
+/**
+ * struct policy_mgr_conn_summary - Connection table summary for lockless
+ * readers
+ * @num_conn: number of connections in use
+ * @mode_count: number of connections per enum policy_mgr_con_mode
+ * @mode_band_mask: BIT(enum reg_wifi_band) of the channels used per mode
+ * @mode_index: connection table indexes per mode, in table order
+ * @vdev_id: vdev id per connection table index
+ */
+struct policy_mgr_conn_summary {
+	uint8_t num_conn;
+	uint8_t mode_count[PM_MAX_NUM_OF_MODE];
+	uint8_t mode_band_mask[PM_MAX_NUM_OF_MODE];
+	uint8_t mode_index[PM_MAX_NUM_OF_MODE][MAX_NUMBER_OF_CONC_CONNECTIONS];
+	uint32_t vdev_id[MAX_NUMBER_OF_CONC_CONNECTIONS];
+};
+
 /**
  * struct policy_mgr_psoc_priv_obj - Policy manager private data
  * @psoc: pointer to PSOC object information
@@ -329,6 +370,14 @@ struct policy_mgr_cfg {
  * @cfg: Policy manager config data
  * @dynamic_mcc_adaptive_sched: disable/enable mcc adaptive scheduler feature
  * @dynamic_dfs_master_disabled: current state of dynamic dfs master
+ * @pcl_cache_gen: generation of the channel and config state PCL depends on,
+ * bumped by policy_mgr_invalidate_pcl_cache()
+ * @pcl_cache: PCL memoized per requesting connection mode, protected by
+ * qdf_conc_list_lock
+ * @conn_summary_seq: number of connection summaries published, the low bit
+ * selects the @conn_summary copy readers use
+ * @conn_summary: two copies of the connection table summary, the one not in
+ * use by readers is rewritten on update
  */
 struct policy_mgr_psoc_priv_obj {
 	struct wlan_objmgr_psoc *psoc;
@@ -370,8 +419,28 @@ struct policy_mgr_psoc_priv_obj {
 	uint32_t valid_ch_freq_list_count;
 	bool dynamic_mcc_adaptive_sched;
 	bool dynamic_dfs_master_disabled;
+	qdf_atomic_t pcl_cache_gen;
+	struct policy_mgr_pcl_cache_entry pcl_cache[PM_MAX_NUM_OF_MODE];
+	qdf_atomic_t conn_summary_seq;
+	struct policy_mgr_conn_summary conn_summary[2];
 };
 
+/**
+ * policy_mgr_invalidate_pcl_cache() - Drop all memoized PCLs
+ * @pm_ctx: policy manager context
+ *
+ * To be called whenever state the PCL is derived from, other than the
+ * connection table, changes: valid/safe/mandatory channel lists, DFS master
+ * and DBS config.
+ *
+ * Return: None
+ */
+static inline void
+policy_mgr_invalidate_pcl_cache(struct policy_mgr_psoc_priv_obj *pm_ctx)
+{
+	qdf_atomic_inc(&pm_ctx->pcl_cache_gen);
+}
+
 /**
  * struct policy_mgr_mac_ss_bw_info - hw_mode_list PHY/MAC params for each MAC
  * @mac_tx_stream: Max TX stream number supported on MAC
@@ -454,6 +523,31 @@ QDF_STATUS policy_mgr_get_old_and_new_hw_index(
 		uint32_t *old_hw_mode_index,
 		uint32_t *new_hw_mode_index);
 
+/**
+ * policy_mgr_publish_conn_summary() - Publish the connection table summary
+ * @pm_ctx: policy manager context
+ *
+ * Rebuilds the summary from pm_conc_connection_list into the copy readers
+ * are not using and then switches readers over to it. Must be called with
+ * qdf_conc_list_lock held after every change to the connection table.
+ *
+ * Return: None
+ */
+void policy_mgr_publish_conn_summary(struct policy_mgr_psoc_priv_obj *pm_ctx);
+
+/**
+ * policy_mgr_get_conn_summary() - Read the connection table summary
+ * @pm_ctx: policy manager context
+ * @summary: summary to fill
+ *
+ * Lockless, never blocks on a writer: a read racing with two publishes is
+ * retried against the newer copy.
+ *
+ * Return: None
+ */
+void policy_mgr_get_conn_summary(struct policy_mgr_psoc_priv_obj *pm_ctx,
+				 struct policy_mgr_conn_summary *summary);
+
 /**
  * policy_mgr_update_conc_list() - Update the concurrent connection list
  * @conn_index: Connection index
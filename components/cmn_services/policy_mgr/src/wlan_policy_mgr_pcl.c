@@ -35,11 +35,17 @@
 #include "wlan_mlme_ucfg_api.h"
 #include "csr_neighbor_roam.h"
 
+/* concurrency table entries are stored as uint8_t */
+QDF_COMPILE_TIME_ASSERT(pm_pcl_type_fits_table_entry,
+			PM_MAX_PCL_TYPE <= 0xFF);
+QDF_COMPILE_TIME_ASSERT(pm_next_action_fits_table_entry,
+			PM_MAX_CONC_NEXT_ACTION <= 0xFF);
+
 /**
  * first_connection_pcl_table - table which provides PCL for the
  * very first connection in the system
  */
-const enum policy_mgr_pcl_type
+const uint8_t
 first_connection_pcl_table[PM_MAX_NUM_OF_MODE]
 			[PM_MAX_CONC_PRIORITY_MODE] = {
 	[PM_STA_MODE] = {PM_NONE, PM_NONE, PM_NONE},
@@ -52,12 +58,12 @@ first_connection_pcl_table[PM_MAX_NUM_OF_MODE]
 pm_dbs_pcl_second_connection_table_type
 		*second_connection_pcl_dbs_table;
 
-enum policy_mgr_pcl_type const
+uint8_t const
 	(*second_connection_pcl_non_dbs_table)[PM_MAX_ONE_CONNECTION_MODE]
 			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE];
 pm_dbs_pcl_third_connection_table_type
 		*third_connection_pcl_dbs_table;
-enum policy_mgr_pcl_type const
+uint8_t const
 	(*third_connection_pcl_non_dbs_table)[PM_MAX_TWO_CONNECTION_MODE]
 			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE];
 policy_mgr_next_action_two_connection_table_type
@@ -258,6 +264,7 @@ policy_mgr_update_valid_ch_freq_list(struct policy_mgr_psoc_priv_obj *pm_ctx,
 		}
 	}
 	pm_ctx->valid_ch_freq_list_count = j;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 }
 
 void
@@ -296,6 +303,7 @@ policy_mgr_reg_chan_change_callback(struct wlan_objmgr_psoc *psoc,
 	for (i = 0; i < pm_ctx->unsafe_channel_count; i++)
 		pm_ctx->unsafe_channel_list[i] =
 			avoid_freq_ind->chan_list.chan_freq_list[i];
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	policy_mgr_debug("Channel list update, received %d avoided channels",
 			 pm_ctx->unsafe_channel_count);
@@ -319,6 +327,7 @@ QDF_STATUS policy_mgr_init_chan_avoidance(struct wlan_objmgr_psoc *psoc,
 
 	for (i = 0; i < pm_ctx->unsafe_channel_count; i++)
 		pm_ctx->unsafe_channel_list[i] = chan_freq_list[i];
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	policy_mgr_debug("Channel list init, received %d avoided channels",
 			 pm_ctx->unsafe_channel_count);
@@ -918,6 +927,98 @@ static inline enum policy_mgr_pcl_type policy_mgr_get_pcl_4_port(
 {return PM_MAX_PCL_TYPE; }
 #endif
 
+/**
+ * policy_mgr_pcl_cache_lookup() - Get the memoized PCL of a connection mode
+ * @pm_ctx: policy manager context
+ * @mode: requesting connection mode
+ * @pcl: PCL type picked from the concurrency tables
+ * @gen: current pcl_cache_gen
+ * @pcl_channels: PCL channel list to fill
+ * @len: length of @pcl_channels to fill
+ * @pcl_weight: PCL weight list to fill
+ * @weight_len: size of @pcl_weight
+ *
+ * The PCL is reused only if it was computed for the same PCL type, the same
+ * connection table and with no channel/config change since then.
+ *
+ * Return: true if the PCL was filled from the cache
+ */
+static bool
+policy_mgr_pcl_cache_lookup(struct policy_mgr_psoc_priv_obj *pm_ctx,
+			    enum policy_mgr_con_mode mode,
+			    enum policy_mgr_pcl_type pcl, uint32_t gen,
+			    uint32_t *pcl_channels, uint32_t *len,
+			    uint8_t *pcl_weight, uint32_t weight_len)
+{
+	struct policy_mgr_pcl_cache_entry *entry = &pm_ctx->pcl_cache[mode];
+	bool hit = false;
+
+	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
+	if (entry->valid && entry->gen == gen && entry->pcl == pcl &&
+	    entry->weight_len == weight_len &&
+	    !qdf_mem_cmp(entry->conn, pm_conc_connection_list,
+			 sizeof(entry->conn))) {
+		qdf_mem_copy(pcl_channels, entry->ch_freq,
+			     entry->len * sizeof(*pcl_channels));
+		qdf_mem_copy(pcl_weight, entry->weight,
+			     qdf_min(entry->len, weight_len));
+		*len = entry->len;
+		hit = true;
+	}
+	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
+
+	return hit;
+}
+
+/**
+ * policy_mgr_pcl_cache_store() - Memoize the PCL of a connection mode
+ * @pm_ctx: policy manager context
+ * @mode: requesting connection mode
+ * @pcl: PCL type picked from the concurrency tables
+ * @gen: pcl_cache_gen read before the PCL was computed
+ * @conn: connection table read before the PCL was computed
+ * @pcl_channels: computed PCL channel list
+ * @len: length of @pcl_channels
+ * @pcl_weight: computed PCL weight list
+ * @weight_len: size of @pcl_weight
+ *
+ * Nothing is stored if the connection table or the generation moved while
+ * the PCL was being computed, as the result may mix old and new state.
+ *
+ * Return: None
+ */
+static void
+policy_mgr_pcl_cache_store(struct policy_mgr_psoc_priv_obj *pm_ctx,
+			   enum policy_mgr_con_mode mode,
+			   enum policy_mgr_pcl_type pcl, uint32_t gen,
+			   struct policy_mgr_conc_connection_info *conn,
+			   uint32_t *pcl_channels, uint32_t len,
+			   uint8_t *pcl_weight, uint32_t weight_len)
+{
+	struct policy_mgr_pcl_cache_entry *entry = &pm_ctx->pcl_cache[mode];
+
+	if (len > NUM_CHANNELS)
+		return;
+
+	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
+	if (gen != qdf_atomic_read(&pm_ctx->pcl_cache_gen) ||
+	    qdf_mem_cmp(conn, pm_conc_connection_list, sizeof(entry->conn))) {
+		entry->valid = false;
+		goto release;
+	}
+
+	entry->gen = gen;
+	entry->pcl = pcl;
+	entry->weight_len = weight_len;
+	qdf_mem_copy(entry->conn, conn, sizeof(entry->conn));
+	entry->len = len;
+	qdf_mem_copy(entry->ch_freq, pcl_channels, len * sizeof(*pcl_channels));
+	qdf_mem_copy(entry->weight, pcl_weight, qdf_min(len, weight_len));
+	entry->valid = true;
+release:
+	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
+}
+
 QDF_STATUS policy_mgr_get_pcl(struct wlan_objmgr_psoc *psoc,
 			      enum policy_mgr_con_mode mode,
 			      uint32_t *pcl_channels, uint32_t *len,
@@ -932,6 +1033,10 @@ QDF_STATUS policy_mgr_get_pcl(struct wlan_objmgr_psoc *psoc,
 	enum policy_mgr_conc_priority_mode conc_system_pref = 0;
 	struct policy_mgr_psoc_priv_obj *pm_ctx;
 	enum QDF_OPMODE qdf_mode;
+	struct policy_mgr_conc_connection_info
+		conn[MAX_NUMBER_OF_CONC_CONNECTIONS];
+	uint32_t gen;
+
 	pm_ctx = policy_mgr_get_context(psoc);
 	if (!pm_ctx) {
 		policy_mgr_err("context is NULL");
@@ -943,6 +1048,11 @@ QDF_STATUS policy_mgr_get_pcl(struct wlan_objmgr_psoc *psoc,
 		return status;
 	}
 
+	gen = qdf_atomic_read(&pm_ctx->pcl_cache_gen);
+	qdf_mutex_acquire(&pm_ctx->qdf_conc_list_lock);
+	qdf_mem_copy(conn, pm_conc_connection_list, sizeof(conn));
+	qdf_mutex_release(&pm_ctx->qdf_conc_list_lock);
+
 	/* find the current connection state from pm_conc_connection_list*/
 	num_connections = policy_mgr_get_connection_count(psoc);
 	policy_mgr_debug("connections:%d pref:%d requested mode:%d",
@@ -1017,6 +1127,14 @@ QDF_STATUS policy_mgr_get_pcl(struct wlan_objmgr_psoc *psoc,
 		break;
 	}
 
+	if (pcl_channels && len && pcl_weight &&
+	    policy_mgr_pcl_cache_lookup(pm_ctx, mode, pcl, gen, pcl_channels,
+					len, pcl_weight, weight_len)) {
+		policy_mgr_debug("mode %d pcl %d: %d channels from cache",
+				 mode, pcl, *len);
+		goto dnbs;
+	}
+
 	/* once the PCL enum is obtained find out the exact channel list with
 	 * help from sme_get_cfg_valid_channels
 	 */
@@ -1032,6 +1150,12 @@ QDF_STATUS policy_mgr_get_pcl(struct wlan_objmgr_psoc *psoc,
 	policy_mgr_mode_specific_modification_on_pcl(
 		psoc, pcl_channels, pcl_weight, len, mode);
 
+	if (pcl_weight)
+		policy_mgr_pcl_cache_store(pm_ctx, mode, pcl, gen, conn,
+					   pcl_channels, *len, pcl_weight,
+					   weight_len);
+
+dnbs:
 	status = policy_mgr_modify_pcl_based_on_dnbs(psoc, pcl_channels,
 						pcl_weight, len);
 
@@ -2380,6 +2504,7 @@ policy_mgr_set_sap_mandatory_channels(struct wlan_objmgr_psoc *psoc,
 	}
 
 	pm_ctx->sap_mandatory_channels_len = len;
+	policy_mgr_invalidate_pcl_cache(pm_ctx);
 
 	return QDF_STATUS_SUCCESS;
 }
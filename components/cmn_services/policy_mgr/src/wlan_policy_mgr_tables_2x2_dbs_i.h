@@ -1753,7 +1753,7 @@ pm_third_connection_pcl_dbs_2x2_table = {
  * the system (with DBS supported by HW), this table is for auto products.
  */
 #ifdef FOURTH_CONNECTION_AUTO
-const enum policy_mgr_pcl_type
+const uint8_t
 fourth_connection_pcl_dbs_table
 	[PM_MAX_THREE_CONNECTION_MODE][PM_MAX_NUM_OF_MODE]
 	[PM_MAX_CONC_PRIORITY_MODE] = {
@@ -1781,7 +1781,7 @@ fourth_connection_pcl_dbs_table
  * other concurrencies supported by auto may not be PORed for mobile products
  * and vice-versa.
  */
-const enum policy_mgr_pcl_type
+const uint8_t
 fourth_connection_pcl_dbs_table
 	[PM_MAX_THREE_CONNECTION_MODE][PM_MAX_NUM_OF_MODE]
 	[PM_MAX_CONC_PRIORITY_MODE] = {
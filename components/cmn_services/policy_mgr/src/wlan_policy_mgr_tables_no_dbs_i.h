@@ -26,7 +26,7 @@
  * for the 2nd connection, when we have a connection already in
  * the system (with DBS not supported by HW)
  */
-static const enum policy_mgr_pcl_type
+static const uint8_t
 second_connection_pcl_nodbs_table[PM_MAX_ONE_CONNECTION_MODE]
 			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE] = {
 	[PM_STA_24_1x1] = {
@@ -192,7 +192,7 @@ second_connection_pcl_nodbs_table[PM_MAX_ONE_CONNECTION_MODE]
  * combination MAX_PCL_TYPE would be the return value, if in future
  * the requirement for 3 port concurrency comes, refer to below table
  * for details.
- * static const enum policy_mgr_pcl_type
+ * static const uint8_t
  * third_connection_pcl_nodbs_table[PM_MAX_TWO_CONNECTION_MODE]
  *			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE] = {
  *	[PM_STA_SAP_SCC_24_1x1] = {
@@ -745,7 +745,7 @@ second_connection_pcl_nodbs_table[PM_MAX_ONE_CONNECTION_MODE]
  *			PM_MAX_PCL_TYPE, PM_MAX_PCL_TYPE, PM_MAX_PCL_TYPE},
  * };
  */
-static const enum policy_mgr_pcl_type
+static const uint8_t
 third_connection_pcl_nodbs_table[PM_MAX_TWO_CONNECTION_MODE]
 			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE] = {
 	[PM_STA_SAP_SCC_24_1x1] = {
@@ -1538,7 +1538,7 @@ third_connection_pcl_nodbs_table[PM_MAX_TWO_CONNECTION_MODE]
  * This table consolidates selection for P2PCLI, P2PGO, STA, SAP
  * into the single set of STA entries for 2.4G and 5G.
  */
-static const enum policy_mgr_pcl_type
+static const uint8_t
 second_connection_pcl_nodbs_no_interband_mcc_table[PM_MAX_ONE_CONNECTION_MODE]
 	[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE] = {
 	[PM_STA_24_1x1] = {
@@ -1719,7 +1719,7 @@ second_connection_pcl_nodbs_no_interband_mcc_table[PM_MAX_ONE_CONNECTION_MODE]
  * PCL for the 3rd connection, when we have two connections already in
  * the system (when DBS and interband mcc are not supported by HW)
  */
-static const enum policy_mgr_pcl_type
+static const uint8_t
 third_connection_pcl_nodbs_no_interband_mcc_table[PM_MAX_TWO_CONNECTION_MODE]
 			[PM_MAX_NUM_OF_MODE][PM_MAX_CONC_PRIORITY_MODE] = {
 	[PM_STA_SAP_SCC_24_1x1] = {
@@ -1122,35 +1122,45 @@ target_if_cm_roam_send_update_config(struct wlan_objmgr_vdev *vdev,
 	wmi_unified_t wmi_handle;
 	struct wlan_objmgr_psoc *psoc;
 	uint8_t vdev_id;
+	uint32_t send = req->send_bitmap;
 
 	wmi_handle = target_if_cm_roam_get_wmi_handle_from_vdev(vdev);
 	if (!wmi_handle)
 		return QDF_STATUS_E_FAILURE;
 
-	status = target_if_cm_roam_scan_bmiss_cnt(wmi_handle,
-						  &req->beacon_miss_cnt);
-	if (QDF_IS_STATUS_ERROR(status)) {
-		target_if_err("vdev set bmiss bcnt param failed");
-		goto end;
+	if (send & BIT(ROAM_UPDATE_CFG_BMISS_CNT)) {
+		status = target_if_cm_roam_scan_bmiss_cnt(
+						wmi_handle,
+						&req->beacon_miss_cnt);
+		if (QDF_IS_STATUS_ERROR(status)) {
+			target_if_err("vdev set bmiss bcnt param failed");
+			goto end;
+		}
 	}
 
-	status = target_if_cm_roam_scan_filter(wmi_handle,
-					       ROAM_SCAN_OFFLOAD_UPDATE_CFG,
-					       &req->scan_filter_params);
-	if (QDF_IS_STATUS_ERROR(status)) {
-		target_if_err("Sending update for roam scan filter failed");
-		goto end;
+	if (send & BIT(ROAM_UPDATE_CFG_SCAN_FILTER)) {
+		status = target_if_cm_roam_scan_filter(
+						wmi_handle,
+						ROAM_SCAN_OFFLOAD_UPDATE_CFG,
+						&req->scan_filter_params);
+		if (QDF_IS_STATUS_ERROR(status)) {
+			target_if_err("Sending update for roam scan filter failed");
+			goto end;
+		}
 	}
 
-	status = target_if_cm_roam_scan_offload_rssi_thresh(
+	if (send & BIT(ROAM_UPDATE_CFG_RSSI_THRESH)) {
+		status = target_if_cm_roam_scan_offload_rssi_thresh(
 							wmi_handle,
 							&req->rssi_params);
-	if (QDF_IS_STATUS_ERROR(status)) {
-		target_if_err("Sending roam scan offload rssi thresh failed");
-		goto end;
+		if (QDF_IS_STATUS_ERROR(status)) {
+			target_if_err("Sending roam scan offload rssi thresh failed");
+			goto end;
+		}
 	}
 
-	if (req->scan_period_params.empty_scan_refresh_period > 0) {
+	if (send & BIT(ROAM_UPDATE_CFG_SCAN_PERIOD) &&
+	    req->scan_period_params.empty_scan_refresh_period > 0) {
 		status = target_if_cm_roam_scan_offload_scan_period(
 						wmi_handle,
 						&req->scan_period_params);
@@ -1158,26 +1168,33 @@ target_if_cm_roam_send_update_config(struct wlan_objmgr_vdev *vdev,
 			goto end;
 	}
 
-	status = target_if_cm_roam_scan_rssi_change_cmd(
-			wmi_handle, &req->rssi_change_params);
-	if (QDF_IS_STATUS_ERROR(status)) {
-		target_if_err("vdev:%d Sending rssi change threshold failed",
-			      req->rssi_change_params.vdev_id);
-		goto end;
+	if (send & BIT(ROAM_UPDATE_CFG_RSSI_CHANGE)) {
+		status = target_if_cm_roam_scan_rssi_change_cmd(
+				wmi_handle, &req->rssi_change_params);
+		if (QDF_IS_STATUS_ERROR(status)) {
+			target_if_err("vdev:%d Sending rssi change threshold failed",
+				      req->rssi_change_params.vdev_id);
+			goto end;
+		}
 	}
 
-	status = target_if_cm_roam_scan_offload_ap_profile(
+	if (send & BIT(ROAM_UPDATE_CFG_AP_PROFILE)) {
+		status = target_if_cm_roam_scan_offload_ap_profile(
 							vdev, wmi_handle,
 							&req->profile_params);
-	if (QDF_IS_STATUS_ERROR(status))
-		goto end;
+		if (QDF_IS_STATUS_ERROR(status))
+			goto end;
+	}
 
-	status = target_if_cm_roam_offload_chan_list(wmi_handle,
-						     &req->rso_chan_info);
-	if (QDF_IS_STATUS_ERROR(status)) {
-		target_if_err("vdev:%d Send channel list command failed",
-			      req->rso_chan_info.vdev_id);
-		goto end;
+	if (send & BIT(ROAM_UPDATE_CFG_CHAN_LIST)) {
+		status = target_if_cm_roam_offload_chan_list(
+							wmi_handle,
+							&req->rso_chan_info);
+		if (QDF_IS_STATUS_ERROR(status)) {
+			target_if_err("vdev:%d Send channel list command failed",
+				      req->rso_chan_info.vdev_id);
+			goto end;
+		}
 	}
 
 	psoc = wlan_vdev_get_psoc(vdev);
@@ -1188,22 +1205,29 @@ target_if_cm_roam_send_update_config(struct wlan_objmgr_vdev *vdev,
 	vdev_id = wlan_vdev_get_id(vdev);
 
 	if (MLME_IS_ROAM_STATE_RSO_ENABLED(psoc, vdev_id)) {
-		status = target_if_cm_roam_scan_offload_mode(wmi_handle,
-							     &req->rso_config);
-		if (QDF_IS_STATUS_ERROR(status)) {
-			target_if_err("vdev:%d Send RSO mode cmd failed",
-				      req->rso_config.vdev_id);
-			goto end;
+		if (send & BIT(ROAM_UPDATE_CFG_RSO_MODE)) {
+			status = target_if_cm_roam_scan_offload_mode(
+							wmi_handle,
+							&req->rso_config);
+			if (QDF_IS_STATUS_ERROR(status)) {
+				target_if_err("vdev:%d Send RSO mode cmd failed",
+					      req->rso_config.vdev_id);
+				goto end;
+			}
 		}
 
-		target_if_cm_roam_disconnect_params(
-				wmi_handle, ROAM_SCAN_OFFLOAD_UPDATE_CFG,
-				&req->disconnect_params);
+		if (send & BIT(ROAM_UPDATE_CFG_DISCONNECT))
+			target_if_cm_roam_disconnect_params(
+					wmi_handle, ROAM_SCAN_OFFLOAD_UPDATE_CFG,
+					&req->disconnect_params);
 
-		target_if_cm_roam_idle_params(
-				wmi_handle, ROAM_SCAN_OFFLOAD_UPDATE_CFG,
-				&req->idle_params);
-		target_if_cm_roam_triggers(vdev, &req->roam_triggers);
+		if (send & BIT(ROAM_UPDATE_CFG_IDLE))
+			target_if_cm_roam_idle_params(
+					wmi_handle, ROAM_SCAN_OFFLOAD_UPDATE_CFG,
+					&req->idle_params);
+
+		if (send & BIT(ROAM_UPDATE_CFG_TRIGGERS))
+			target_if_cm_roam_triggers(vdev, &req->roam_triggers);
 	}
 end:
 	return status;
@@ -988,10 +988,7 @@ target_if_cp_stats_extract_peer_stats_event(struct wmi_unified *wmi_hdl,
 {
 	QDF_STATUS status;
 	wmi_host_stats_event stats_param = {0};
-	struct peer_stats_info_ext_event *peer_stats_info;
-	wmi_host_peer_stats_info stats_info;
 	uint32_t peer_stats_info_size;
-	int i, j;
 
 	status = wmi_extract_peer_stats_param(wmi_hdl, data, &stats_param);
 	if (QDF_IS_STATUS_ERROR(status)) {
@@ -1013,37 +1010,15 @@ target_if_cp_stats_extract_peer_stats_event(struct wmi_unified *wmi_hdl,
 		return QDF_STATUS_E_NOMEM;
 	}
 
-	peer_stats_info = ev->peer_stats_info_ext;
-	for (i = 0; i < ev->num_peer_stats_info_ext; i++) {
-		status = wmi_extract_peer_stats_info(wmi_hdl, data,
-						     i, &stats_info);
-		if (QDF_IS_STATUS_ERROR(status)) {
-			cp_stats_err("peer stats info extract failed: %d",
-				     status);
-			qdf_mem_free(ev->peer_stats_info_ext);
-			ev->peer_stats_info_ext = NULL;
-			ev->num_peer_stats_info_ext = 0;
-			return status;
-		}
-		qdf_mem_copy(&peer_stats_info->peer_macaddr,
-			     &stats_info.peer_macaddr,
-			     sizeof(peer_stats_info->peer_macaddr));
-		peer_stats_info->tx_packets = stats_info.tx_packets;
-		peer_stats_info->tx_bytes = stats_info.tx_bytes;
-		peer_stats_info->rx_packets = stats_info.rx_packets;
-		peer_stats_info->rx_bytes = stats_info.rx_bytes;
-		peer_stats_info->tx_retries = stats_info.tx_retries;
-		peer_stats_info->tx_failed = stats_info.tx_failed;
-		peer_stats_info->tx_succeed = stats_info.tx_succeed;
-		peer_stats_info->rssi = stats_info.peer_rssi;
-		peer_stats_info->tx_rate = stats_info.last_tx_bitrate_kbps;
-		peer_stats_info->tx_rate_code = stats_info.last_tx_rate_code;
-		peer_stats_info->rx_rate = stats_info.last_rx_bitrate_kbps;
-		peer_stats_info->rx_rate_code = stats_info.last_rx_rate_code;
-		for (j = 0; j < WMI_MAX_CHAINS; j++)
-			peer_stats_info->peer_rssi_per_chain[j] =
-					      stats_info.peer_rssi_per_chain[j];
-		peer_stats_info++;
+	status = wmi_extract_all_peer_stats_info(wmi_hdl, data,
+						 ev->num_peer_stats_info_ext,
+						 ev->peer_stats_info_ext);
+	if (QDF_IS_STATUS_ERROR(status)) {
+		cp_stats_err("peer stats info extract failed: %d", status);
+		qdf_mem_free(ev->peer_stats_info_ext);
+		ev->peer_stats_info_ext = NULL;
+		ev->num_peer_stats_info_ext = 0;
+		return status;
 	}
 
 	return QDF_STATUS_SUCCESS;
@@ -198,6 +198,11 @@ static void tdls_ct_sampling_tx_rx(struct tdls_vdev_priv_obj *tdls_vdev,
 	uint8_t mac_entries;
 	struct tdls_conn_tracker_mac_table mac_table[WLAN_TDLS_CT_TABLE_SIZE];
 
+	/* Fold the counts batched by the data path into the mac table */
+	if (tdls_soc->tdls_ct_flush_cb)
+		tdls_soc->tdls_ct_flush_cb(tdls_soc->tdls_ct_cb_data,
+					   tdls_vdev->vdev);
+
 	qdf_spin_lock_bh(&tdls_soc->tdls_ct_spinlock);
 
 	if (0 == tdls_vdev->valid_mac_entries) {
@@ -231,9 +236,9 @@ static void tdls_ct_sampling_tx_rx(struct tdls_vdev_priv_obj *tdls_vdev,
 	}
 }
 
-void tdls_update_rx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				 struct qdf_mac_addr *mac_addr,
-				 struct qdf_mac_addr *dest_mac_addr)
+void tdls_update_pkt_cnt(struct wlan_objmgr_vdev *vdev,
+			 struct qdf_mac_addr *mac_addr,
+			 uint32_t tx_cnt, uint32_t rx_cnt)
 {
 	struct tdls_vdev_priv_obj *tdls_vdev_obj;
 	struct tdls_soc_priv_obj *tdls_soc_obj;
@@ -249,30 +254,9 @@ void tdls_update_rx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
 	if (!tdls_soc_obj->enable_tdls_connection_tracker)
 		return;
 
-	/* Here we do without lock to ensure that in high throughput scenarios
-	 * its fast and we quickly check the right mac entry and increment
-	 * the pkt count. Here it may happen that
-	 * "tdls_vdev_obj->valid_mac_entries", "tdls_vdev_obj->ct_peer_table"
-	 * becomes zero in another thread but we are ok as this will not
-	 * lead to any crash.
-	 */
-	valid_mac_entries = tdls_vdev_obj->valid_mac_entries;
-	mac_table = tdls_vdev_obj->ct_peer_table;
-
-	for (mac_cnt = 0; mac_cnt < valid_mac_entries; mac_cnt++) {
-		if (qdf_mem_cmp(mac_table[mac_cnt].mac_address.bytes,
-		    mac_addr, QDF_MAC_ADDR_SIZE) == 0) {
-			mac_table[mac_cnt].rx_packet_cnt++;
-			return;
-		}
-	}
-
 	if (qdf_is_macaddr_group(mac_addr))
 		return;
 
-	if (qdf_is_macaddr_group(dest_mac_addr))
-		return;
-
 	if (!qdf_mem_cmp(vdev->vdev_mlme.macaddr, mac_addr,
 			 QDF_MAC_ADDR_SIZE))
 		return;
@@ -286,105 +270,35 @@ void tdls_update_rx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
 		}
 		wlan_objmgr_peer_release_ref(bss_peer, WLAN_TDLS_NB_ID);
 	}
-	qdf_spin_lock_bh(&tdls_soc_obj->tdls_ct_spinlock);
-
-	/* when we take the lock we need to get the valid mac entries
-	 * again as it may become zero in another thread and if is 0 then
-	 * we need to reset "mac_cnt" to zero so that at zeroth index we
-	 * add new entry
-	 */
-	valid_mac_entries = tdls_vdev_obj->valid_mac_entries;
-	if (!valid_mac_entries)
-		mac_cnt = 0;
-
-	/* If we have more than 8 peers within 30 mins. we will
-	 *  stop tracking till the old entries are removed
-	 */
-	if (mac_cnt < WLAN_TDLS_CT_TABLE_SIZE) {
-		qdf_mem_copy(mac_table[mac_cnt].mac_address.bytes,
-		       mac_addr, QDF_MAC_ADDR_SIZE);
-		tdls_vdev_obj->valid_mac_entries = mac_cnt+1;
-		mac_table[mac_cnt].rx_packet_cnt = 1;
-	}
-
-	qdf_spin_unlock_bh(&tdls_soc_obj->tdls_ct_spinlock);
-	return;
-}
-
-void tdls_update_tx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-			    struct qdf_mac_addr *mac_addr)
-{
-	struct tdls_vdev_priv_obj *tdls_vdev_obj;
-	struct tdls_soc_priv_obj *tdls_soc_obj;
-	uint8_t mac_cnt;
-	uint8_t valid_mac_entries;
-	struct tdls_conn_tracker_mac_table *mac_table;
-	struct wlan_objmgr_peer *bss_peer;
-
-	if (QDF_STATUS_SUCCESS != tdls_get_vdev_objects(vdev, &tdls_vdev_obj,
-							&tdls_soc_obj))
-		return;
 
-	if (!tdls_soc_obj->enable_tdls_connection_tracker)
-		return;
+	qdf_spin_lock_bh(&tdls_soc_obj->tdls_ct_spinlock);
 
-	/* Here we do without lock to ensure that in high throughput scenarios
-	 * its fast and we quickly check the right mac entry and increment
-	 * the pkt count. Here it may happen that
-	 * "tdls_vdev_obj->valid_mac_entries", "tdls_vdev_obj->ct_peer_table"
-	 * becomes zero in another thread but we are ok as this will not
-	 * lead to any crash.
-	 */
 	mac_table = tdls_vdev_obj->ct_peer_table;
-	valid_mac_entries = tdls_vdev_obj->valid_mac_entries;
+	valid_mac_entries = QDF_MIN(tdls_vdev_obj->valid_mac_entries,
+				    WLAN_TDLS_CT_TABLE_SIZE);
 
 	for (mac_cnt = 0; mac_cnt < valid_mac_entries; mac_cnt++) {
 		if (qdf_mem_cmp(mac_table[mac_cnt].mac_address.bytes,
-		    mac_addr, QDF_MAC_ADDR_SIZE) == 0) {
-			mac_table[mac_cnt].tx_packet_cnt++;
-			return;
-		}
-	}
-
-	if (qdf_is_macaddr_group(mac_addr))
-		return;
-
-	if (!qdf_mem_cmp(vdev->vdev_mlme.macaddr, mac_addr,
-			 QDF_MAC_ADDR_SIZE))
-		return;
-	bss_peer = wlan_objmgr_vdev_try_get_bsspeer(vdev, WLAN_TDLS_NB_ID);
-	if (bss_peer) {
-		if (!qdf_mem_cmp(bss_peer->macaddr, mac_addr,
-				 QDF_MAC_ADDR_SIZE)) {
-			wlan_objmgr_peer_release_ref(bss_peer, WLAN_TDLS_NB_ID);
-			return;
+				mac_addr, QDF_MAC_ADDR_SIZE) == 0) {
+			mac_table[mac_cnt].tx_packet_cnt += tx_cnt;
+			mac_table[mac_cnt].rx_packet_cnt += rx_cnt;
+			goto unlock;
 		}
-		wlan_objmgr_peer_release_ref(bss_peer, WLAN_TDLS_NB_ID);
 	}
 
-	qdf_spin_lock_bh(&tdls_soc_obj->tdls_ct_spinlock);
-
-	/* when we take the lock we need to get the valid mac entries
-	 * again as it may become zero in another thread and if is 0 then
-	 * we need to reset "mac_cnt" to zero so that at zeroth index we
-	 * add new entry
-	 */
-	valid_mac_entries = tdls_vdev_obj->valid_mac_entries;
-	if (!valid_mac_entries)
-		mac_cnt = 0;
-
 	/* If we have more than 8 peers within 30 mins. we will
 	 *  stop tracking till the old entries are removed
 	 */
 	if (mac_cnt < WLAN_TDLS_CT_TABLE_SIZE) {
 		qdf_mem_copy(mac_table[mac_cnt].mac_address.bytes,
-			mac_addr, QDF_MAC_ADDR_SIZE);
-		mac_table[mac_cnt].tx_packet_cnt = 1;
-		tdls_vdev_obj->valid_mac_entries++;
+			     mac_addr, QDF_MAC_ADDR_SIZE);
+		mac_table[mac_cnt].tx_packet_cnt = tx_cnt;
+		mac_table[mac_cnt].rx_packet_cnt = rx_cnt;
+		tdls_vdev_obj->valid_mac_entries = mac_cnt + 1;
 	}
 
+unlock:
 	qdf_spin_unlock_bh(&tdls_soc_obj->tdls_ct_spinlock);
-	return;
 }
 
 void tdls_implicit_send_discovery_request(
@@ -44,42 +44,24 @@
 void tdls_implicit_enable(struct tdls_vdev_priv_obj *tdls_vdev);
 
 /**
- * tdls_update_rx_pkt_cnt() - Update rx packet count
- * @vdev: vdev object manager
- * @mac_addr: mac address of the data
- * @dest_mac_addr: dest mac address of the data
- *
- * Increase the rx packet count, if the sender is not bssid and the packet is
- * not broadcast and multicast packet
- *
- * This sampling information will be used in TDLS connection tracker
- *
- * This function expected to be called in an atomic context so blocking APIs
- * not allowed
- *
- * Return: None
- */
-void tdls_update_rx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				     struct qdf_mac_addr *mac_addr,
-				     struct qdf_mac_addr *dest_mac_addr);
-
-/**
- * tdls_update_tx_pkt_cnt() - update tx packet
+ * tdls_update_pkt_cnt() - add a batch of tx/rx packets to the tracker
  * @vdev: vdev object
- * @mac_addr: mac address of the data
+ * @mac_addr: peer mac address of the data
+ * @tx_cnt: number of packets sent to @mac_addr
+ * @rx_cnt: number of packets received from @mac_addr
  *
- * Increase the tx packet count, if the sender is not bssid and the packet is
- * not broadcast and multicast packet
+ * Account the packets exchanged with @mac_addr since the last flush, if the
+ * peer is not the bssid and not a broadcast or multicast address. The data
+ * path batches these counts and hands them over once per connection tracker
+ * period through tdls_ct_flush_callback.
  *
  * This sampling information will be used in TDLS connection tracker
  *
- * This function expected to be called in an atomic context so blocking APIs
- * not allowed
- *
  * Return: None
  */
-void tdls_update_tx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				     struct qdf_mac_addr *mac_addr);
+void tdls_update_pkt_cnt(struct wlan_objmgr_vdev *vdev,
+			 struct qdf_mac_addr *mac_addr,
+			 uint32_t tx_cnt, uint32_t rx_cnt);
 
 /**
  * wlan_hdd_tdls_implicit_send_discovery_request() - send discovery request
@@ -191,6 +191,8 @@ struct tdls_set_state_info {
  * @runtime_lock: runtime lock
  * @tdls_osif_init_cb: Callback to initialize the tdls private
  * @tdls_osif_deinit_cb: Callback to deinitialize the tdls private
+ * @tdls_ct_flush_cb: Callback to flush the data path batched tx/rx counts
+ * @tdls_ct_cb_data: userdata for @tdls_ct_flush_cb
  * @fw_tdls_11ax_capablity: bool for tdls 11ax fw capability
  */
 struct tdls_soc_priv_obj {
@@ -240,6 +242,8 @@ struct tdls_soc_priv_obj {
 #endif
 	tdls_vdev_init_cb tdls_osif_init_cb;
 	tdls_vdev_deinit_cb tdls_osif_deinit_cb;
+	tdls_ct_flush_callback tdls_ct_flush_cb;
+	void *tdls_ct_cb_data;
 #ifdef WLAN_FEATURE_11AX
 	bool fw_tdls_11ax_capability;
 #endif
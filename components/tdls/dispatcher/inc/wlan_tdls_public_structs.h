@@ -651,6 +651,21 @@ typedef QDF_STATUS (*tdls_vdev_init_cb)(struct wlan_objmgr_vdev *vdev);
  */
 typedef void (*tdls_vdev_deinit_cb)(struct wlan_objmgr_vdev *vdev);
 
+/**
+ * tdls_ct_flush_callback() - Callback to flush batched tx/rx counts
+ * @userdata: tdls_ct_cb_data passed in tdls_start_params
+ * @vdev: vdev object
+ *
+ * The data path batches the per peer tx/rx packet counts instead of
+ * reporting every packet. The connection tracker invokes this callback once
+ * per sampling period and the data path hands the counts accumulated since
+ * the previous flush over with ucfg_tdls_update_pkt_cnt().
+ *
+ * Return: None
+ */
+typedef void (*tdls_ct_flush_callback)(void *userdata,
+				       struct wlan_objmgr_vdev *vdev);
+
 /**
  * struct tdls_start_params - tdls start params
  * @config: tdls user config
@@ -667,6 +682,8 @@ typedef void (*tdls_vdev_deinit_cb)(struct wlan_objmgr_vdev *vdev);
  * @tdls_dp_vdev_update: update vdev flags in datapath
  * @tdls_osif_init_cb: callback to initialize the tdls priv
  * @tdls_osif_deinit_cb: callback to deinitialize the tdls priv
+ * @tdls_ct_flush_cb: callback to flush the batched tx/rx counts
+ * @tdls_ct_cb_data: userdata for @tdls_ct_flush_cb
  */
 struct tdls_start_params {
 	struct tdls_user_config config;
@@ -687,6 +704,8 @@ struct tdls_start_params {
 	tdls_dp_vdev_update_flags_callback tdls_dp_vdev_update;
 	tdls_vdev_init_cb tdls_osif_init_cb;
 	tdls_vdev_deinit_cb tdls_osif_deinit_cb;
+	tdls_ct_flush_callback tdls_ct_flush_cb;
+	void *tdls_ct_cb_data;
 };
 
 /**
@@ -251,26 +251,28 @@ QDF_STATUS ucfg_tdls_set_operating_mode(
 			struct tdls_set_mode_params *set_mode_params);
 
 /**
- * ucfg_tdls_update_rx_pkt_cnt() - update rx pkt count
+ * ucfg_tdls_update_pkt_cnt() - update tx/rx pkt count with a batch
  * @vdev: tdls vdev object
  * @mac_addr: peer mac address
- * @dest_mac_addr: dest mac address
+ * @tx_cnt: number of packets sent to the peer since the last flush
+ * @rx_cnt: number of packets received from the peer since the last flush
  *
  * Return: None
  */
-void ucfg_tdls_update_rx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				 struct qdf_mac_addr *mac_addr,
-				 struct qdf_mac_addr *dest_mac_addr);
+void ucfg_tdls_update_pkt_cnt(struct wlan_objmgr_vdev *vdev,
+			      struct qdf_mac_addr *mac_addr,
+			      uint32_t tx_cnt, uint32_t rx_cnt);
 
 /**
- * ucfg_tdls_update_tx_pkt_cnt() - update tx pkt count
- * @vdev: tdls vdev object
- * @mac_addr: peer mac address
+ * ucfg_tdls_is_ct_enabled() - check if the tdls connection tracker runs
+ * @psoc: psoc object
  *
- * Return: None
+ * Lockless check for the data path, which skips counting tx/rx packets
+ * for the connection tracker while it is off.
+ *
+ * Return: true if the connection tracker is enabled
  */
-void ucfg_tdls_update_tx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				 struct qdf_mac_addr *mac_addr);
+bool ucfg_tdls_is_ct_enabled(struct wlan_objmgr_psoc *psoc);
 
 /**
  * ucfg_tdls_antenna_switch() - tdls antenna switch
@@ -388,16 +390,16 @@ QDF_STATUS ucfg_tdls_psoc_disable(struct wlan_objmgr_psoc *psoc)
 }
 
 static inline
-void ucfg_tdls_update_rx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				 struct qdf_mac_addr *mac_addr,
-				 struct qdf_mac_addr *dest_mac_addr)
+void ucfg_tdls_update_pkt_cnt(struct wlan_objmgr_vdev *vdev,
+			      struct qdf_mac_addr *mac_addr,
+			      uint32_t tx_cnt, uint32_t rx_cnt)
 {
 }
 
 static inline
-void ucfg_tdls_update_tx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				 struct qdf_mac_addr *mac_addr)
+bool ucfg_tdls_is_ct_enabled(struct wlan_objmgr_psoc *psoc)
 {
+	return false;
 }
 
 static inline
@@ -393,6 +393,8 @@ QDF_STATUS ucfg_tdls_update_config(struct wlan_objmgr_psoc *psoc,
 	soc_obj->tdls_dp_vdev_update = req->tdls_dp_vdev_update;
 	soc_obj->tdls_osif_init_cb = req->tdls_osif_init_cb;
 	soc_obj->tdls_osif_deinit_cb = req->tdls_osif_deinit_cb;
+	soc_obj->tdls_ct_flush_cb = req->tdls_ct_flush_cb;
+	soc_obj->tdls_ct_cb_data = req->tdls_ct_cb_data;
 	tdls_pm_call_backs.tdls_notify_increment_session =
 			tdls_notify_increment_session;
 
@@ -948,18 +950,23 @@ QDF_STATUS ucfg_tdls_set_operating_mode(
 	return QDF_STATUS_SUCCESS;
 }
 
-void ucfg_tdls_update_rx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				 struct qdf_mac_addr *mac_addr,
-				 struct qdf_mac_addr *dest_mac_addr)
+void ucfg_tdls_update_pkt_cnt(struct wlan_objmgr_vdev *vdev,
+			      struct qdf_mac_addr *mac_addr,
+			      uint32_t tx_cnt, uint32_t rx_cnt)
 {
-	tdls_update_rx_pkt_cnt(vdev, mac_addr, dest_mac_addr);
-
+	tdls_update_pkt_cnt(vdev, mac_addr, tx_cnt, rx_cnt);
 }
 
-void ucfg_tdls_update_tx_pkt_cnt(struct wlan_objmgr_vdev *vdev,
-				 struct qdf_mac_addr *mac_addr)
+bool ucfg_tdls_is_ct_enabled(struct wlan_objmgr_psoc *psoc)
 {
-	tdls_update_tx_pkt_cnt(vdev, mac_addr);
+	struct tdls_soc_priv_obj *soc_obj;
+
+	soc_obj = wlan_objmgr_psoc_get_comp_private_obj(psoc,
+							WLAN_UMAC_COMP_TDLS);
+	if (!soc_obj)
+		return false;
+
+	return soc_obj->enable_tdls_connection_tracker;
 }
 
 QDF_STATUS ucfg_tdls_antenna_switch(struct wlan_objmgr_vdev *vdev,
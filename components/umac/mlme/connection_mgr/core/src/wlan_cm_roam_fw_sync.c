@@ -44,6 +44,7 @@
 #include "connection_mgr/core/src/wlan_cm_roam.h"
 #include "connection_mgr/core/src/wlan_cm_main.h"
 #include "connection_mgr/core/src/wlan_cm_sm.h"
+#include "connection_mgr/core/src/wlan_cm_roam_offload.h"
 
 QDF_STATUS cm_fw_roam_sync_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
 			       uint8_t *event, uint32_t event_data_len)
@@ -768,6 +769,7 @@ cm_fw_roam_sync_propagation(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
 		cm_roam_start_init_on_connect(pdev, vdev_id);
 	}
 
+	cm_roam_update_cfg_invalidate(psoc, vdev_id);
 	wlan_cm_tgt_send_roam_sync_complete_cmd(psoc, vdev_id);
 	status = cm_sm_deliver_event_sync(cm_ctx, WLAN_CM_SM_EV_ROAM_DONE,
 					  sizeof(*roam_synch_data),
@@ -919,6 +921,8 @@ QDF_STATUS cm_fw_roam_invoke_fail(struct wlan_objmgr_psoc *psoc,
 	cm_id = roam_req->cm_id;
 	source = roam_req->req.source;
 
+	cm_roam_update_cfg_invalidate(psoc, vdev_id);
+
 	status = cm_sm_deliver_event(vdev, WLAN_CM_SM_EV_ROAM_INVOKE_FAIL,
 				     sizeof(wlan_cm_id), &cm_id);
 
@@ -980,6 +984,7 @@ static QDF_STATUS cm_handle_ho_fail(struct scheduler_msg *msg)
 		cm_id = roam_req->cm_id;
 	}
 
+	cm_roam_update_cfg_invalidate(ind->psoc, ind->vdev_id);
 	cm_sm_deliver_event(vdev, WLAN_CM_SM_EV_ROAM_HO_FAIL,
 			    sizeof(wlan_cm_id), &cm_id);
 
@@ -675,6 +675,7 @@ cm_roam_send_disable_config(struct wlan_objmgr_psoc *psoc,
 	req->vdev_id = vdev_id;
 	req->cfg = cfg;
 
+	cm_roam_update_cfg_invalidate(psoc, vdev_id);
 	status = wlan_cm_tgt_send_roam_disable_config(psoc, vdev_id, req);
 	if (QDF_IS_STATUS_ERROR(status))
 		mlme_debug("fail to send roam disable config");
@@ -695,6 +696,8 @@ cm_roam_send_disable_config(struct wlan_objmgr_psoc *psoc,
 static QDF_STATUS
 cm_roam_init_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id, bool enable)
 {
+	cm_roam_update_cfg_invalidate(psoc, vdev_id);
+
 	return wlan_cm_tgt_send_roam_offload_init(psoc, vdev_id, enable);
 }
 
@@ -722,6 +725,8 @@ QDF_STATUS cm_rso_set_roam_trigger(struct wlan_objmgr_pdev *pdev,
 	if (QDF_IS_STATUS_ERROR(status))
 		return status;
 
+	cm_roam_update_cfg_invalidate(psoc, vdev_id);
+
 	return wlan_cm_tgt_send_roam_triggers(psoc, vdev_id, trigger);
 }
 
@@ -2385,6 +2390,7 @@ cm_roam_start_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
 	cm_roam_offload_11k_params(psoc, vdev, &start_req->roam_11k_params,
 				   true);
 
+	rso_cfg->update_cfg_synced = 0;
 	status = wlan_cm_tgt_send_roam_start_req(psoc, vdev_id, start_req);
 	if (QDF_IS_STATUS_ERROR(status))
 		mlme_debug("fail to send roam start");
@@ -2397,6 +2403,154 @@ free_mem:
 	return status;
 }
 
+#define CM_ROAM_UPDATE_CFG_SECTION(_id, _field) \
+	[_id] = { \
+		offsetof(struct wlan_roam_update_config, _field), \
+		sizeof(((struct wlan_roam_update_config *)0)->_field) \
+	}
+
+/*
+ * Location of each section of struct wlan_roam_update_config compared
+ * against the copy last sent to firmware. For the scan filter only the
+ * filter params are compared, the reason only selects whether it is sent.
+ */
+static const struct {
+	uint32_t offset;
+	uint32_t size;
+} cm_roam_update_cfg_sections[ROAM_UPDATE_CFG_MAX] = {
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_BMISS_CNT,
+				   beacon_miss_cnt),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_SCAN_FILTER,
+				   scan_filter_params.filter_params),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_RSSI_THRESH,
+				   rssi_params),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_SCAN_PERIOD,
+				   scan_period_params),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_RSSI_CHANGE,
+				   rssi_change_params),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_AP_PROFILE,
+				   profile_params),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_CHAN_LIST,
+				   rso_chan_info),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_RSO_MODE,
+				   rso_config),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_DISCONNECT,
+				   disconnect_params),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_IDLE,
+				   idle_params),
+	CM_ROAM_UPDATE_CFG_SECTION(ROAM_UPDATE_CFG_TRIGGERS,
+				   roam_triggers),
+};
+
+/**
+ * cm_roam_update_cfg_sendable() - Sections of the update config which
+ * target_if sends to firmware
+ * @psoc: psoc pointer
+ * @vdev_id: vdev id
+ * @reason: reason for the roam update config
+ *
+ * Return: bitmap of enum wlan_roam_update_cfg_id
+ */
+static uint32_t
+cm_roam_update_cfg_sendable(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
+			    uint8_t reason)
+{
+	uint32_t sendable = ROAM_UPDATE_CFG_ALL;
+
+	if (reason != REASON_ROAM_SET_BLACKLIST_BSSID &&
+	    reason != REASON_ROAM_SET_SSID_ALLOWED &&
+	    reason != REASON_ROAM_SET_FAVORED_BSSID)
+		sendable &= ~BIT(ROAM_UPDATE_CFG_SCAN_FILTER);
+
+	if (!MLME_IS_ROAM_STATE_RSO_ENABLED(psoc, vdev_id))
+		sendable &= ~(BIT(ROAM_UPDATE_CFG_RSO_MODE) |
+			      BIT(ROAM_UPDATE_CFG_DISCONNECT) |
+			      BIT(ROAM_UPDATE_CFG_IDLE) |
+			      BIT(ROAM_UPDATE_CFG_TRIGGERS));
+
+	return sendable;
+}
+
+/**
+ * cm_roam_update_cfg_diff() - Select the update config sections to send
+ * @rso_cfg: rso config holding the copy last sent to firmware
+ * @req: filled roam update config request
+ * @sendable: sections target_if sends to firmware for this request
+ *
+ * Sections which firmware already has, or which target_if would not send,
+ * are cleared from the send bitmap of @req and the remaining ones are
+ * recorded as sent. Target_if may modify
+ * @req while sending, so the copy is taken before the request is sent.
+ * The RSO mode command makes firmware apply the other sections, so it is
+ * sent whenever any other section changed.
+ *
+ * Return: None
+ */
+static void
+cm_roam_update_cfg_diff(struct rso_config *rso_cfg,
+			struct wlan_roam_update_config *req,
+			uint32_t sendable)
+{
+	struct wlan_roam_update_config *cache;
+	uint8_t *new_val, *old_val;
+	uint32_t offset, size;
+	uint8_t id;
+
+	req->send_bitmap = ROAM_UPDATE_CFG_ALL;
+
+	if (!rso_cfg->update_cfg_cache) {
+		rso_cfg->update_cfg_synced = 0;
+		rso_cfg->update_cfg_cache = qdf_mem_malloc(sizeof(*cache));
+		if (!rso_cfg->update_cfg_cache)
+			return;
+	}
+	cache = rso_cfg->update_cfg_cache;
+
+	for (id = 0; id < ROAM_UPDATE_CFG_MAX; id++) {
+		if (!(sendable & BIT(id))) {
+			req->send_bitmap &= ~BIT(id);
+			rso_cfg->update_cfg_synced &= ~BIT(id);
+			continue;
+		}
+
+		offset = cm_roam_update_cfg_sections[id].offset;
+		size = cm_roam_update_cfg_sections[id].size;
+		new_val = (uint8_t *)req + offset;
+		old_val = (uint8_t *)cache + offset;
+
+		if (rso_cfg->update_cfg_synced & BIT(id) &&
+		    !qdf_mem_cmp(new_val, old_val, size)) {
+			req->send_bitmap &= ~BIT(id);
+			continue;
+		}
+
+		qdf_mem_copy(old_val, new_val, size);
+		rso_cfg->update_cfg_synced |= BIT(id);
+	}
+
+	if (req->send_bitmap & ROAM_UPDATE_CFG_ALL &
+	    ~BIT(ROAM_UPDATE_CFG_RSO_MODE))
+		req->send_bitmap |= BIT(ROAM_UPDATE_CFG_RSO_MODE);
+}
+
+void cm_roam_update_cfg_invalidate(struct wlan_objmgr_psoc *psoc,
+				   uint8_t vdev_id)
+{
+	struct wlan_objmgr_vdev *vdev;
+	struct rso_config *rso_cfg;
+
+	vdev = wlan_objmgr_get_vdev_by_id_from_psoc(psoc, vdev_id,
+						    WLAN_MLME_CM_ID);
+	if (!vdev)
+		return;
+
+	rso_cfg = wlan_cm_get_rso_config(vdev);
+	if (rso_cfg)
+		rso_cfg->update_cfg_synced = 0;
+
+	wlan_objmgr_vdev_release_ref(vdev, WLAN_MLME_CM_ID);
+}
+
 /**
  * cm_roam_update_config_req() - roam update config request handling
  * @psoc: psoc pointer
@@ -2464,9 +2618,21 @@ cm_roam_update_config_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
 					      ROAM_SCAN_OFFLOAD_UPDATE_CFG,
 					      reason);
 
+	cm_roam_update_cfg_diff(rso_cfg, update_req,
+				cm_roam_update_cfg_sendable(psoc, vdev_id,
+							    reason));
+	if (!update_req->send_bitmap) {
+		mlme_debug("vdev %d reason %d: roam config unchanged",
+			   vdev_id, reason);
+		status = QDF_STATUS_SUCCESS;
+		goto rel_vdev_ref;
+	}
+
 	status = wlan_cm_tgt_send_roam_update_req(psoc, vdev_id, update_req);
-	if (QDF_IS_STATUS_ERROR(status))
+	if (QDF_IS_STATUS_ERROR(status)) {
 		mlme_debug("fail to send update config");
+		rso_cfg->update_cfg_synced = 0;
+	}
 
 rel_vdev_ref:
 	wlan_objmgr_vdev_release_ref(vdev, WLAN_MLME_CM_ID);
@@ -2528,6 +2694,7 @@ cm_roam_abort_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
 {
 	QDF_STATUS status;
 
+	cm_roam_update_cfg_invalidate(psoc, vdev_id);
 	status = wlan_cm_tgt_send_roam_abort_req(psoc, vdev_id);
 	if (QDF_IS_STATUS_ERROR(status))
 		mlme_debug("fail to send abort start");
@@ -2626,6 +2793,7 @@ cm_roam_stop_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
 					      NULL, ROAM_SCAN_OFFLOAD_STOP,
 					      stop_req->reason);
 
+	rso_cfg->update_cfg_synced = 0;
 	status = wlan_cm_tgt_send_roam_stop_req(psoc, vdev_id, stop_req);
 	if (QDF_IS_STATUS_ERROR(status)) {
 		mlme_debug("fail to send roam stop");
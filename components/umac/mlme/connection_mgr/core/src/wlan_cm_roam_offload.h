@@ -89,6 +89,21 @@ QDF_STATUS
 cm_roam_stop_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id,
 		 uint8_t reason);
 
+/**
+ * cm_roam_update_cfg_invalidate() - Forget the roam update config last sent
+ * to firmware
+ * @psoc: psoc pointer
+ * @vdev_id: vdev id
+ *
+ * Called before any other roam command which can change the firmware roam
+ * config, and when a roam is aborted or fails, so that the next roam update
+ * config is sent in full.
+ *
+ * Return: None
+ */
+void cm_roam_update_cfg_invalidate(struct wlan_objmgr_psoc *psoc,
+				   uint8_t vdev_id);
+
 /**
  * cm_roam_fill_rssi_change_params() - Fill roam scan rssi change parameters
  * @psoc: PSOC pointer
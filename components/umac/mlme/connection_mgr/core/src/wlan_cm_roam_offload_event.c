@@ -36,6 +36,7 @@
 #include "connection_mgr/core/src/wlan_cm_roam.h"
 #include "connection_mgr/core/src/wlan_cm_sm.h"
 #include "connection_mgr/core/src/wlan_cm_main_api.h"
+#include "connection_mgr/core/src/wlan_cm_roam_offload.h"
 
 #define FW_ROAM_SYNC_TIMEOUT 7000
 
@@ -324,6 +325,9 @@ QDF_STATUS cm_fw_roam_abort_req(struct wlan_objmgr_psoc *psoc, uint8_t vdev_id)
 	if (roam_req)
 		cm_id = roam_req->cm_id;
 
+	/* the aborted roam may have left the firmware config out of sync */
+	cm_roam_update_cfg_invalidate(psoc, vdev_id);
+
 	/* continue even if no roam command is found */
 	status = wlan_cm_roam_state_change(pdev, vdev_id, WLAN_ROAM_RSO_ENABLED,
 					   REASON_ROAM_ABORT);
@@ -307,6 +307,10 @@ enum roam_fail_params {
  * @roam_invoke_fail_reason: One of reason id from enum
  * wmi_roam_invoke_status_error in case of forced roam
  * @lost_link_rssi: lost link RSSI
+ * @update_cfg_cache: last roam update config sent to firmware, section by
+ * section, allocated on first update
+ * @update_cfg_synced: bitmap of enum wlan_roam_update_cfg_id sections of
+ * @update_cfg_cache known to match the firmware state
  */
 struct rso_config {
 	qdf_mutex_t cm_rso_lock;
@@ -345,6 +349,8 @@ struct rso_config {
 	uint32_t roam_trigger_reason;
 	uint32_t roam_invoke_fail_reason;
 	int32_t lost_link_rssi;
+	struct wlan_roam_update_config *update_cfg_cache;
+	uint32_t update_cfg_synced;
 };
 
 /**
@@ -1502,9 +1508,42 @@ struct wlan_roam_stop_config {
 	struct wlan_roam_offload_scan_rssi_params rssi_params;
 };
 
+/**
+ * enum wlan_roam_update_cfg_id - WMI commands sent for a roam update config
+ * @ROAM_UPDATE_CFG_BMISS_CNT: roam beacon miss count
+ * @ROAM_UPDATE_CFG_SCAN_FILTER: roam scan filter
+ * @ROAM_UPDATE_CFG_RSSI_THRESH: roam scan rssi threshold
+ * @ROAM_UPDATE_CFG_SCAN_PERIOD: roam scan period
+ * @ROAM_UPDATE_CFG_RSSI_CHANGE: roam scan rssi change threshold
+ * @ROAM_UPDATE_CFG_AP_PROFILE: ap profile and scoring params
+ * @ROAM_UPDATE_CFG_CHAN_LIST: roam scan channel list
+ * @ROAM_UPDATE_CFG_RSO_MODE: roam scan mode, commits the other sections
+ * @ROAM_UPDATE_CFG_DISCONNECT: disconnect roam trigger params
+ * @ROAM_UPDATE_CFG_IDLE: idle roam trigger params
+ * @ROAM_UPDATE_CFG_TRIGGERS: roam trigger bitmap
+ * @ROAM_UPDATE_CFG_MAX: max number of sections
+ */
+enum wlan_roam_update_cfg_id {
+	ROAM_UPDATE_CFG_BMISS_CNT,
+	ROAM_UPDATE_CFG_SCAN_FILTER,
+	ROAM_UPDATE_CFG_RSSI_THRESH,
+	ROAM_UPDATE_CFG_SCAN_PERIOD,
+	ROAM_UPDATE_CFG_RSSI_CHANGE,
+	ROAM_UPDATE_CFG_AP_PROFILE,
+	ROAM_UPDATE_CFG_CHAN_LIST,
+	ROAM_UPDATE_CFG_RSO_MODE,
+	ROAM_UPDATE_CFG_DISCONNECT,
+	ROAM_UPDATE_CFG_IDLE,
+	ROAM_UPDATE_CFG_TRIGGERS,
+	ROAM_UPDATE_CFG_MAX,
+};
+
+#define ROAM_UPDATE_CFG_ALL (BIT(ROAM_UPDATE_CFG_MAX) - 1)
+
 /**
  * struct wlan_roam_update_config - structure containing parameters for
  * roam update config
+ * @send_bitmap: bitmap of enum wlan_roam_update_cfg_id commands to send
  * @beacon_miss_cnt: roam beacon miss count parameters
  * @scan_filter_params: roam scan filter parameters
  * @scan_period_params: roam scan period parameters
@@ -1518,6 +1557,7 @@ struct wlan_roam_stop_config {
  * @roam_triggers: roam triggers parameters
  */
 struct wlan_roam_update_config {
+	uint32_t send_bitmap;
 	struct wlan_roam_beacon_miss_cnt beacon_miss_cnt;
 	struct wlan_roam_scan_filter_params scan_filter_params;
 	struct wlan_roam_scan_period_params scan_period_params;
@@ -1346,6 +1346,11 @@ void wlan_cm_rso_config_deinit(struct wlan_objmgr_vdev *vdev,
 		qdf_mem_free(rso_cfg->roam_scan_freq_lst.freq_list);
 	rso_cfg->roam_scan_freq_lst.freq_list = NULL;
 	rso_cfg->roam_scan_freq_lst.num_chan = 0;
+	if (rso_cfg->update_cfg_cache) {
+		qdf_mem_free(rso_cfg->update_cfg_cache);
+		rso_cfg->update_cfg_cache = NULL;
+		rso_cfg->update_cfg_synced = 0;
+	}
 
 	cm_flush_roam_channel_list(&cfg_params->specific_chan_info);
 	cm_flush_roam_channel_list(&cfg_params->pref_chan_info);
@@ -98,6 +98,24 @@ wmi_extract_peer_stats_info(wmi_unified_t wmi_handle, void *evt_buf,
 			    uint32_t index,
 			    wmi_host_peer_stats_info *peer_stats_info);
 
+/**
+ * wmi_extract_all_peer_stats_info() - extract stats info of all peers from
+ * event
+ * @wmi_handle: wmi handle
+ * @evt_buf: pointer to event buffer
+ * @num_peers: number of peers, as returned by wmi_extract_peer_stats_param()
+ * @peer_stats_info: array of @num_peers entries to hold peer stats info
+ *
+ * The event is validated once and its peer stats info TLV array is converted
+ * straight into @peer_stats_info in a single pass.
+ *
+ * Return: QDF_STATUS_SUCCESS on success and QDF_STATUS_E_FAILURE for failure
+ */
+QDF_STATUS
+wmi_extract_all_peer_stats_info(wmi_unified_t wmi_handle, void *evt_buf,
+				uint32_t num_peers,
+				struct peer_stats_info_ext_event *peer_stats_info);
+
 #ifdef WLAN_FEATURE_BIG_DATA_STATS
 /**
  * wmi_extract_big_data_stats_param() - extract big data statsfrom event
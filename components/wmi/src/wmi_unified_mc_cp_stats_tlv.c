@@ -18,6 +18,7 @@
 #include "wmi.h"
 #include "wmi_unified_priv.h"
 #include "wmi_unified_param.h"
+#include "wmi_unified_mc_cp_stats_api.h"
 
 /**
  * extract_per_chain_rssi_stats_tlv() - api to extract rssi stats from event
@@ -424,6 +425,72 @@ extract_peer_stats_info_tlv(wmi_unified_t wmi_handle, void *evt_buf,
 	return QDF_STATUS_SUCCESS;
 }
 
+/*
+ * struct wmi_ops has no bulk peer stats info op, so the bulk conversion is
+ * done right here on the TLV event. It is only valid for a handle with the
+ * TLV ops of this file attached.
+ */
+QDF_STATUS
+wmi_extract_all_peer_stats_info(wmi_unified_t wmi_handle, void *evt_buf,
+				uint32_t num_peers,
+				struct peer_stats_info_ext_event *peer_stats_info)
+{
+	WMI_PEER_STATS_INFO_EVENTID_param_tlvs *param_buf;
+	wmi_peer_stats_info_event_fixed_param *ev_param;
+	wmi_peer_stats_info *ev;
+	uint32_t i;
+	int j;
+
+	if (wmi_handle->ops->extract_peer_stats_info !=
+	    extract_peer_stats_info_tlv)
+		return QDF_STATUS_E_FAILURE;
+
+	param_buf = (WMI_PEER_STATS_INFO_EVENTID_param_tlvs *)evt_buf;
+	if (!param_buf || !peer_stats_info)
+		return QDF_STATUS_E_FAILURE;
+
+	ev_param = param_buf->fixed_param;
+	if (!ev_param || !param_buf->peer_stats_info)
+		return QDF_STATUS_E_FAILURE;
+
+	if (num_peers > ev_param->num_peers ||
+	    num_peers > param_buf->num_peer_stats_info) {
+		wmi_err_rl("num peers: %d exceeds provided peers: %d or actual peers stats info: %d",
+			   num_peers, ev_param->num_peers,
+			   param_buf->num_peer_stats_info);
+		return QDF_STATUS_E_FAULT;
+	}
+
+	ev = param_buf->peer_stats_info;
+	for (i = 0; i < num_peers; i++, ev++, peer_stats_info++) {
+		dump_peer_stats_info(ev);
+
+		WMI_MAC_ADDR_TO_CHAR_ARRAY(&ev->peer_macaddr,
+					   peer_stats_info->peer_macaddr.bytes);
+		peer_stats_info->tx_packets = ev->tx_packets.low_32;
+		peer_stats_info->tx_bytes = ev->tx_bytes.high_32;
+		peer_stats_info->tx_bytes <<= 32;
+		peer_stats_info->tx_bytes += ev->tx_bytes.low_32;
+		peer_stats_info->rx_packets = ev->rx_packets.low_32;
+		peer_stats_info->rx_bytes = ev->rx_bytes.high_32;
+		peer_stats_info->rx_bytes <<= 32;
+		peer_stats_info->rx_bytes += ev->rx_bytes.low_32;
+		peer_stats_info->tx_retries = ev->tx_retries;
+		peer_stats_info->tx_failed = ev->tx_failed;
+		peer_stats_info->tx_succeed = ev->tx_succeed;
+		peer_stats_info->rssi = ev->peer_rssi;
+		peer_stats_info->tx_rate = ev->last_tx_bitrate_kbps;
+		peer_stats_info->tx_rate_code = ev->last_tx_rate_code;
+		peer_stats_info->rx_rate = ev->last_rx_bitrate_kbps;
+		peer_stats_info->rx_rate_code = ev->last_rx_rate_code;
+		for (j = 0; j < WMI_MAX_CHAINS; j++)
+			peer_stats_info->peer_rssi_per_chain[j] =
+						     ev->peer_rssi_per_chain[j];
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
 #ifdef WLAN_FEATURE_BIG_DATA_STATS
 /**
  * extract_big_data_stats_tlv() - extract big data from event
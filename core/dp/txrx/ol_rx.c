@@ -28,7 +28,7 @@
 #include <ol_htt_rx_api.h>      /* htt_rx_peer_id, etc. */
 
 /* internal API header files */
-#include <ol_txrx_peer_find.h>  /* ol_txrx_peer_find_by_id */
+#include <ol_txrx_peer_find.h>  /* ol_txrx_peer_get_ref_by_id_rcu */
 #include <ol_rx_reorder.h>      /* ol_rx_reorder_store, etc. */
 #include <ol_rx_reorder_timeout.h>      /* OL_RX_REORDER_TIMEOUT_UPDATE */
 #include <ol_rx_defrag.h>       /* ol_rx_defrag_waitlist_flush */
@@ -511,16 +511,16 @@ ol_rx_ocb_update_peer(ol_txrx_pdev_handle pdev, qdf_nbuf_t rx_ind_msg,
 }
 #endif
 
-void
-ol_rx_indication_handler(ol_txrx_pdev_handle pdev,
-			 qdf_nbuf_t rx_ind_msg,
-			 uint16_t peer_id, uint8_t tid, int num_mpdu_ranges)
+static void
+__ol_rx_indication_handler(ol_txrx_pdev_handle pdev,
+			   qdf_nbuf_t rx_ind_msg,
+			   struct ol_txrx_peer_t *peer,
+			   uint8_t tid, int num_mpdu_ranges)
 {
 	int mpdu_range;
 	unsigned int seq_num_start = 0, seq_num_end = 0;
 	bool rx_ind_release = false;
 	struct ol_txrx_vdev_t *vdev = NULL;
-	struct ol_txrx_peer_t *peer;
 	htt_pdev_handle htt_pdev;
 	uint16_t center_freq;
 	uint16_t chan1;
@@ -530,7 +530,6 @@ ol_rx_indication_handler(ol_txrx_pdev_handle pdev,
 	uint32_t msdu_count = 0;
 
 	htt_pdev = pdev->htt_pdev;
-	peer = ol_txrx_peer_find_by_id(pdev, peer_id);
 	if (!peer) {
 		/*
 		 * If we can't find a peer send this packet to OCB interface
@@ -790,6 +789,22 @@ ol_rx_indication_handler(ol_txrx_pdev_handle pdev,
 	if (pdev->rx.flags.defrag_timeout_check)
 		ol_rx_defrag_waitlist_flush(pdev);
 }
+
+void
+ol_rx_indication_handler(ol_txrx_pdev_handle pdev,
+			 qdf_nbuf_t rx_ind_msg,
+			 uint16_t peer_id, uint8_t tid, int num_mpdu_ranges)
+{
+	struct ol_txrx_peer_t *peer;
+
+	/* hold the peer until its rx reorder state is no longer used */
+	peer = ol_txrx_peer_get_ref_by_id_rcu(pdev, peer_id,
+					      PEER_DEBUG_ID_OL_INTERNAL);
+	__ol_rx_indication_handler(pdev, rx_ind_msg, peer, tid,
+				   num_mpdu_ranges);
+	if (peer)
+		ol_txrx_peer_release_ref(peer, PEER_DEBUG_ID_OL_INTERNAL);
+}
 #endif
 
 void
@@ -801,7 +816,8 @@ ol_rx_sec_ind_handler(ol_txrx_pdev_handle pdev,
 	struct ol_txrx_peer_t *peer;
 	int sec_index, i;
 
-	peer = ol_txrx_peer_find_by_id(pdev, peer_id);
+	peer = ol_txrx_peer_get_ref_by_id_rcu(pdev, peer_id,
+					      PEER_DEBUG_ID_OL_INTERNAL);
 	if (!peer) {
 		ol_txrx_err(
 			"Couldn't find peer from ID %d - skipping security inits\n",
@@ -846,6 +862,7 @@ ol_rx_sec_ind_handler(ol_txrx_pdev_handle pdev,
 				peer->tids_rekey_flag[i] = 1;
 		}
 	}
+	ol_txrx_peer_release_ref(peer, PEER_DEBUG_ID_OL_INTERNAL);
 }
 
 void ol_rx_notify(struct cdp_cfg *cfg_pdev,
@@ -934,9 +951,12 @@ ol_rx_offload_deliver_ind_handler(ol_txrx_pdev_handle pdev,
 	while (msdu_cnt) {
 		if (!htt_rx_offload_msdu_pop(htt_pdev, msg, &vdev_id, &peer_id,
 					&tid, &fw_desc, &head_buf, &tail_buf)) {
-			peer = ol_txrx_peer_find_by_id(pdev, peer_id);
+			peer = ol_txrx_peer_get_ref_by_id_rcu(pdev, peer_id,
+						PEER_DEBUG_ID_OL_INTERNAL);
 			if (peer) {
 				ol_rx_data_process(peer, head_buf);
+				ol_txrx_peer_release_ref(peer,
+						PEER_DEBUG_ID_OL_INTERNAL);
 			} else {
 				buf = head_buf;
 				while (1) {
@@ -1008,7 +1028,8 @@ ol_rx_mic_error_handler(
 
 	if (pdev) {
 		TXRX_STATS_MSDU_INCR(pdev, rx.dropped_mic_err, msdu);
-		peer = ol_txrx_peer_find_by_id(pdev, peer_id);
+		peer = ol_txrx_peer_get_ref_by_id_rcu(pdev, peer_id,
+						PEER_DEBUG_ID_OL_INTERNAL);
 		if (peer) {
 			vdev = peer->vdev;
 			if (vdev) {
@@ -1028,6 +1049,9 @@ ol_rx_mic_error_handler(
 		}
 		/* Pktlog */
 		ol_rx_send_pktlog_event(pdev, peer, msdu, 1);
+		if (peer)
+			ol_txrx_peer_release_ref(peer,
+						 PEER_DEBUG_ID_OL_INTERNAL);
 	}
 }
 
@@ -1554,14 +1578,14 @@ void ol_rx_frames_free(htt_pdev_handle htt_pdev, qdf_nbuf_t frames)
 }
 
 #ifdef WLAN_FULL_REORDER_OFFLOAD
-void
-ol_rx_in_order_indication_handler(ol_txrx_pdev_handle pdev,
-				  qdf_nbuf_t rx_ind_msg,
-				  uint16_t peer_id,
-				  uint8_t tid, uint8_t is_offload)
+static void
+__ol_rx_in_order_indication_handler(ol_txrx_pdev_handle pdev,
+				    qdf_nbuf_t rx_ind_msg,
+				    uint16_t peer_id,
+				    struct ol_txrx_peer_t *peer,
+				    uint8_t tid, uint8_t is_offload)
 {
 	struct ol_txrx_vdev_t *vdev = NULL;
-	struct ol_txrx_peer_t *peer = NULL;
 	struct ol_txrx_peer_t *peer_head = NULL;
 	htt_pdev_handle htt_pdev = NULL;
 	int status;
@@ -1587,8 +1611,6 @@ ol_rx_in_order_indication_handler(ol_txrx_pdev_handle pdev,
 	if (pdev) {
 		if (qdf_unlikely(QDF_GLOBAL_MONITOR_MODE == cds_get_conparam()))
 			peer = pdev->self_peer;
-		else
-			peer = ol_txrx_peer_find_by_id(pdev, peer_id);
 		htt_pdev = pdev->htt_pdev;
 	} else {
 		ol_txrx_err("Invalid pdev passed!");
@@ -1704,6 +1726,25 @@ ol_rx_in_order_indication_handler(ol_txrx_pdev_handle pdev,
 
 	peer->rx_opt_proc(vdev, peer, tid, head_msdu);
 }
+
+void
+ol_rx_in_order_indication_handler(ol_txrx_pdev_handle pdev,
+				  qdf_nbuf_t rx_ind_msg,
+				  uint16_t peer_id,
+				  uint8_t tid, uint8_t is_offload)
+{
+	struct ol_txrx_peer_t *peer = NULL;
+
+	/* hold the peer until the MSDUs are handed to its rx_opt_proc */
+	if (pdev &&
+	    qdf_likely(QDF_GLOBAL_MONITOR_MODE != cds_get_conparam()))
+		peer = ol_txrx_peer_get_ref_by_id_rcu(pdev, peer_id,
+						      PEER_DEBUG_ID_OL_INTERNAL);
+	__ol_rx_in_order_indication_handler(pdev, rx_ind_msg, peer_id, peer,
+					    tid, is_offload);
+	if (peer)
+		ol_txrx_peer_release_ref(peer, PEER_DEBUG_ID_OL_INTERNAL);
+}
 #endif
 
 #ifndef REMOVE_PKT_LOG
@@ -1741,7 +1782,8 @@ void ol_rx_pkt_dump_call(
 		return;
 	}
 
-	peer = ol_txrx_peer_find_by_id(pdev, peer_id);
+	peer = ol_txrx_peer_get_ref_by_id_rcu(pdev, peer_id,
+					      PEER_DEBUG_ID_OL_INTERNAL);
 	if (!peer) {
 		ol_txrx_dbg("peer with peer id %d is NULL", peer_id);
 		return;
@@ -1752,6 +1794,7 @@ void ol_rx_pkt_dump_call(
 	    wlan_op_mode_sta == peer->vdev->opmode)
 		packetdump_cb(soc_hdl, OL_TXRX_PDEV_ID, peer->vdev->vdev_id,
 			      msdu, status, RX_DATA_PKT);
+	ol_txrx_peer_release_ref(peer, PEER_DEBUG_ID_OL_INTERNAL);
 }
 #endif
 
@@ -1824,7 +1867,9 @@ ol_rx_offload_paddr_deliver_ind_handler(htt_pdev_handle htt_pdev,
 			continue;
 		}
 
-		peer = ol_txrx_peer_find_by_id(htt_pdev->txrx_pdev, peer_id);
+		peer = ol_txrx_peer_get_ref_by_id_rcu(htt_pdev->txrx_pdev,
+						      peer_id,
+						      PEER_DEBUG_ID_OL_INTERNAL);
 		if (peer) {
 			QDF_NBUF_CB_DP_TRACE_PRINT(head_buf) = false;
 			qdf_dp_trace_set_track(head_buf, QDF_RX);
@@ -1839,6 +1884,8 @@ ol_rx_offload_paddr_deliver_ind_handler(htt_pdev_handle htt_pdev,
 				qdf_nbuf_data_addr(head_buf),
 				sizeof(qdf_nbuf_data(head_buf)), QDF_RX));
 			ol_rx_data_process(peer, head_buf);
+			ol_txrx_peer_release_ref(peer,
+						 PEER_DEBUG_ID_OL_INTERNAL);
 		} else {
 			buf = head_buf;
 			while (1) {
@@ -79,6 +79,127 @@ static char g_log2ceil[] = {
 		}							\
 	} while (0)
 
+/* reorder array pool */
+
+/**
+ * ol_rx_reorder_array_class() - size class of a power of 2 window size
+ * @round_pwr2_win_sz: window size rounded up to a power of 2
+ *
+ * Return: index into the reorder array pool free lists
+ */
+static inline uint8_t ol_rx_reorder_array_class(unsigned int round_pwr2_win_sz)
+{
+	uint8_t class = 0;
+
+	while (round_pwr2_win_sz > 1) {
+		round_pwr2_win_sz >>= 1;
+		class++;
+	}
+
+	return class;
+}
+
+void ol_rx_reorder_array_pool_init(struct ol_txrx_pdev_t *pdev)
+{
+	struct ol_rx_reorder_array_pool *pool = &pdev->rx.reorder_array_pool;
+
+	qdf_spinlock_create(&pool->lock);
+	qdf_mem_zero(pool->freelist, sizeof(pool->freelist));
+	qdf_mem_zero(pool->num_free, sizeof(pool->num_free));
+}
+
+void ol_rx_reorder_array_pool_deinit(struct ol_txrx_pdev_t *pdev)
+{
+	struct ol_rx_reorder_array_pool *pool = &pdev->rx.reorder_array_pool;
+	void *array;
+	uint8_t class;
+
+	qdf_spin_lock_bh(&pool->lock);
+	for (class = 0; class < OL_RX_REORDER_ARRAY_NUM_CLASSES; class++) {
+		while (pool->freelist[class]) {
+			array = pool->freelist[class];
+			pool->freelist[class] = *(void **)array;
+			qdf_mem_free(array);
+		}
+		pool->num_free[class] = 0;
+	}
+	qdf_spin_unlock_bh(&pool->lock);
+	qdf_spinlock_destroy(&pool->lock);
+}
+
+/**
+ * ol_rx_reorder_array_alloc() - get a reorder array for a BA window
+ * @pdev: physical device handle
+ * @round_pwr2_win_sz: window size rounded up to a power of 2
+ *
+ * Return: zeroed reorder array or NULL on allocation failure
+ */
+static struct ol_rx_reorder_array_elem_t *
+ol_rx_reorder_array_alloc(struct ol_txrx_pdev_t *pdev,
+			  unsigned int round_pwr2_win_sz)
+{
+	struct ol_rx_reorder_array_pool *pool = &pdev->rx.reorder_array_pool;
+	unsigned int array_size =
+		round_pwr2_win_sz * sizeof(struct ol_rx_reorder_array_elem_t);
+	uint8_t class = ol_rx_reorder_array_class(round_pwr2_win_sz);
+	void *array;
+
+	qdf_spin_lock_bh(&pool->lock);
+	array = pool->freelist[class];
+	if (array) {
+		pool->freelist[class] = *(void **)array;
+		pool->num_free[class]--;
+	}
+	qdf_spin_unlock_bh(&pool->lock);
+
+	if (!array)
+		return qdf_mem_malloc(array_size);
+
+	qdf_mem_zero(array, array_size);
+
+	return array;
+}
+
+/**
+ * ol_rx_reorder_array_free() - release the reorder array of a TID
+ * @pdev: physical device handle
+ * @rx_reorder: TID reorder state owning the array
+ *
+ * The array is cached in the pool for its size class unless that class
+ * already holds OL_RX_REORDER_ARRAY_POOL_DEPTH arrays.
+ *
+ * Return: None
+ */
+static void ol_rx_reorder_array_free(struct ol_txrx_pdev_t *pdev,
+				     struct ol_rx_reorder_t *rx_reorder)
+{
+	struct ol_rx_reorder_array_pool *pool = &pdev->rx.reorder_array_pool;
+	void *array = rx_reorder->array;
+	uint8_t class = ol_rx_reorder_array_class(rx_reorder->win_sz_mask + 1);
+
+	qdf_spin_lock_bh(&pool->lock);
+	if (pool->num_free[class] < OL_RX_REORDER_ARRAY_POOL_DEPTH) {
+		*(void **)array = pool->freelist[class];
+		pool->freelist[class] = array;
+		pool->num_free[class]++;
+		array = NULL;
+	}
+	qdf_spin_unlock_bh(&pool->lock);
+
+	if (array)
+		qdf_mem_free(array);
+}
+
+void ol_rx_reorder_release_array(struct ol_txrx_pdev_t *pdev,
+				 struct ol_rx_reorder_t *rx_reorder)
+{
+	if (rx_reorder->array == &rx_reorder->base)
+		return;
+
+	ol_rx_reorder_array_free(pdev, rx_reorder);
+	ol_rx_reorder_init(rx_reorder, rx_reorder->tid);
+}
+
 /* functions called by txrx components */
 
 void ol_rx_reorder_init(struct ol_rx_reorder_t *rx_reorder, uint8_t tid)
@@ -523,7 +644,6 @@ ol_rx_addba_handler(ol_txrx_pdev_handle pdev,
 		    uint8_t win_sz, uint16_t start_seq_num, uint8_t failed)
 {
 	uint8_t round_pwr2_win_sz;
-	unsigned int array_size;
 	struct ol_txrx_peer_t *peer;
 	struct ol_rx_reorder_t *rx_reorder;
 	void *array_mem = NULL;
@@ -552,16 +672,14 @@ ol_rx_addba_handler(ol_txrx_pdev_handle pdev,
 
 	TXRX_ASSERT2(win_sz <= 64);
 	round_pwr2_win_sz = OL_RX_REORDER_ROUND_PWR2(win_sz);
-	array_size =
-		round_pwr2_win_sz * sizeof(struct ol_rx_reorder_array_elem_t);
 
-	array_mem = qdf_mem_malloc(array_size);
+	array_mem = ol_rx_reorder_array_alloc(pdev, round_pwr2_win_sz);
 	if (!array_mem)
 		return;
 
 	if (rx_reorder->array != &rx_reorder->base) {
 		ol_txrx_info("delete array for tid %d", tid);
-		qdf_mem_free(rx_reorder->array);
+		ol_rx_reorder_array_free(pdev, rx_reorder);
 	}
 
 	rx_reorder->array = array_mem;
@@ -609,7 +727,7 @@ ol_rx_delba_handler(ol_txrx_pdev_handle pdev, uint16_t peer_id, uint8_t tid)
 	if (rx_reorder->array != &rx_reorder->base) {
 		ol_txrx_dbg("delete reorder array, tid:%d",
 			    tid);
-		qdf_mem_free(rx_reorder->array);
+		ol_rx_reorder_array_free(pdev, rx_reorder);
 	}
 
 	/* set up the TID with default parameters (ARQ window size = 1) */
@@ -64,6 +64,35 @@ ol_rx_reorder_peer_cleanup(struct ol_txrx_vdev_t *vdev,
 
 void ol_rx_reorder_init(struct ol_rx_reorder_t *rx_reorder, uint8_t tid);
 
+/**
+ * ol_rx_reorder_array_pool_init() - init the pdev reorder array cache
+ * @pdev: physical device handle
+ *
+ * Return: None
+ */
+void ol_rx_reorder_array_pool_init(struct ol_txrx_pdev_t *pdev);
+
+/**
+ * ol_rx_reorder_array_pool_deinit() - free all cached reorder arrays
+ * @pdev: physical device handle
+ *
+ * Return: None
+ */
+void ol_rx_reorder_array_pool_deinit(struct ol_txrx_pdev_t *pdev);
+
+/**
+ * ol_rx_reorder_release_array() - give back a TID's BA reorder array
+ * @pdev: physical device handle
+ * @rx_reorder: TID reorder state
+ *
+ * Returns the array allocated by the ADDBA handler to the pdev cache and
+ * resets the TID to the single element non-aggregation reorder state.
+ *
+ * Return: None
+ */
+void ol_rx_reorder_release_array(struct ol_txrx_pdev_t *pdev,
+				 struct ol_rx_reorder_t *rx_reorder);
+
 enum htt_rx_status
 ol_rx_seq_num_check(struct ol_txrx_pdev_t *pdev,
 			    struct ol_txrx_peer_t *peer,
@@ -49,17 +49,30 @@ static inline void ol_tx_desc_reset_pkt_type(struct ol_tx_desc_t *tx_desc)
 	tx_desc->pkt_type = ol_tx_frm_freed;
 }
 #ifdef QCA_COMPUTE_TX_DELAY
-static inline void ol_tx_desc_compute_delay(struct ol_tx_desc_t *tx_desc)
+static inline void ol_tx_desc_compute_delay(struct ol_txrx_pdev_t *pdev,
+					    struct ol_tx_desc_t *tx_desc)
 {
-	if (tx_desc->entry_timestamp_ticks != 0xffffffff) {
-		ol_txrx_err("Timestamp:0x%x", tx_desc->entry_timestamp_ticks);
+	struct ol_tx_desc_cold_t *cold = ol_tx_desc_cold(pdev, tx_desc);
+
+	if (cold->entry_timestamp_ticks != 0xffffffff) {
+		ol_txrx_err("Timestamp:0x%x", cold->entry_timestamp_ticks);
 		qdf_assert(0);
 	}
-	tx_desc->entry_timestamp_ticks = qdf_system_ticks();
+	cold->entry_timestamp_ticks = qdf_system_ticks();
+}
+static inline void ol_tx_desc_reset_timestamp(struct ol_txrx_pdev_t *pdev,
+					      struct ol_tx_desc_t *tx_desc)
+{
+	ol_tx_desc_cold(pdev, tx_desc)->entry_timestamp_ticks = 0xffffffff;
 }
-static inline void ol_tx_desc_reset_timestamp(struct ol_tx_desc_t *tx_desc)
+#else
+static inline void ol_tx_desc_compute_delay(struct ol_txrx_pdev_t *pdev,
+					    struct ol_tx_desc_t *tx_desc)
+{
+}
+static inline void ol_tx_desc_reset_timestamp(struct ol_txrx_pdev_t *pdev,
+					      struct ol_tx_desc_t *tx_desc)
 {
-	tx_desc->entry_timestamp_ticks = 0xffffffff;
 }
 #endif
 #else
@@ -70,23 +83,28 @@ static inline void ol_tx_desc_sanity_checks(struct ol_txrx_pdev_t *pdev,
 static inline void ol_tx_desc_reset_pkt_type(struct ol_tx_desc_t *tx_desc)
 {
 }
-static inline void ol_tx_desc_compute_delay(struct ol_tx_desc_t *tx_desc)
+static inline void ol_tx_desc_compute_delay(struct ol_txrx_pdev_t *pdev,
+					    struct ol_tx_desc_t *tx_desc)
 {
 }
-static inline void ol_tx_desc_reset_timestamp(struct ol_tx_desc_t *tx_desc)
+static inline void ol_tx_desc_reset_timestamp(struct ol_txrx_pdev_t *pdev,
+					      struct ol_tx_desc_t *tx_desc)
 {
 }
 #endif
 
 #ifdef DESC_TIMESTAMP_DEBUG_INFO
-static inline void ol_tx_desc_update_tx_ts(struct ol_tx_desc_t *tx_desc)
+static inline void ol_tx_desc_update_tx_ts(struct ol_txrx_pdev_t *pdev,
+					   struct ol_tx_desc_t *tx_desc)
 {
-	tx_desc->desc_debug_info.prev_tx_ts = tx_desc
-						->desc_debug_info.curr_tx_ts;
-	tx_desc->desc_debug_info.curr_tx_ts = qdf_get_log_timestamp();
+	struct ol_tx_desc_cold_t *cold = ol_tx_desc_cold(pdev, tx_desc);
+
+	cold->desc_debug_info.prev_tx_ts = cold->desc_debug_info.curr_tx_ts;
+	cold->desc_debug_info.curr_tx_ts = qdf_get_log_timestamp();
 }
 #else
-static inline void ol_tx_desc_update_tx_ts(struct ol_tx_desc_t *tx_desc)
+static inline void ol_tx_desc_update_tx_ts(struct ol_txrx_pdev_t *pdev,
+					   struct ol_tx_desc_t *tx_desc)
 {
 }
 #endif
@@ -245,10 +263,10 @@ struct ol_tx_desc_t *ol_tx_desc_alloc(struct ol_txrx_pdev_t *pdev,
 		ol_tx_desc_dup_detect_set(pdev, tx_desc);
 		ol_tx_do_pdev_flow_control_pause(pdev);
 		ol_tx_desc_sanity_checks(pdev, tx_desc);
-		ol_tx_desc_compute_delay(tx_desc);
+		ol_tx_desc_compute_delay(pdev, tx_desc);
 		ol_tx_desc_vdev_update(tx_desc, vdev);
 		ol_tx_desc_count_inc(vdev);
-		ol_tx_desc_update_tx_ts(tx_desc);
+		ol_tx_desc_update_tx_ts(pdev, tx_desc);
 		qdf_atomic_inc(&tx_desc->ref_cnt);
 	}
 	qdf_spin_unlock_bh(&pdev->tx_mutex);
@@ -317,8 +335,8 @@ struct ol_tx_desc_t *ol_tx_desc_alloc(struct ol_txrx_pdev_t *pdev,
 		qdf_spin_unlock_bh(&pool->flow_pool_lock);
 
 		ol_tx_desc_sanity_checks(pdev, tx_desc);
-		ol_tx_desc_compute_delay(tx_desc);
-		ol_tx_desc_update_tx_ts(tx_desc);
+		ol_tx_desc_compute_delay(pdev, tx_desc);
+		ol_tx_desc_update_tx_ts(pdev, tx_desc);
 		ol_tx_desc_vdev_update(tx_desc, vdev);
 		qdf_atomic_inc(&tx_desc->ref_cnt);
 	} else {
@@ -517,7 +535,7 @@ static void ol_tx_desc_free_common(struct ol_txrx_pdev_t *pdev,
 		ol_tx_tso_desc_free(pdev, tx_desc);
 
 	ol_tx_desc_reset_pkt_type(tx_desc);
-	ol_tx_desc_reset_timestamp(tx_desc);
+	ol_tx_desc_reset_timestamp(pdev, tx_desc);
 	/* clear the ref cnt */
 	qdf_atomic_init(&tx_desc->ref_cnt);
 	tx_desc->vdev_id = OL_TXRX_INVALID_VDEV_ID;
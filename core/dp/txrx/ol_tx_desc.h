@@ -469,6 +469,63 @@ void ol_tx_desc_dup_detect_reset(struct ol_txrx_pdev_t *pdev,
 }
 #endif
 
+#ifdef OL_TX_DESC_COLD_INFO
+/**
+ * ol_tx_desc_cold_init() - allocate the tx descriptor cold data array
+ * @pdev: pdev handle
+ * @pool_size: global pool size
+ *
+ * Return: 0 on success, -ENOMEM on allocation failure
+ */
+static inline
+int ol_tx_desc_cold_init(struct ol_txrx_pdev_t *pdev, uint16_t pool_size)
+{
+	pdev->tx_desc.cold_array =
+		qdf_mem_malloc(pool_size * sizeof(*pdev->tx_desc.cold_array));
+	if (!pdev->tx_desc.cold_array)
+		return -ENOMEM;
+
+	return 0;
+}
+
+/**
+ * ol_tx_desc_cold_deinit() - free the tx descriptor cold data array
+ * @pdev: pdev handle
+ *
+ * Return: none
+ */
+static inline
+void ol_tx_desc_cold_deinit(struct ol_txrx_pdev_t *pdev)
+{
+	qdf_mem_free(pdev->tx_desc.cold_array);
+	pdev->tx_desc.cold_array = NULL;
+}
+
+/**
+ * ol_tx_desc_cold() - get the cold data of a tx descriptor
+ * @pdev: pdev handle
+ * @tx_desc: tx descriptor
+ *
+ * Return: cold data entry sharing the id of @tx_desc
+ */
+static inline struct ol_tx_desc_cold_t *
+ol_tx_desc_cold(struct ol_txrx_pdev_t *pdev, struct ol_tx_desc_t *tx_desc)
+{
+	return &pdev->tx_desc.cold_array[tx_desc->id];
+}
+#else
+static inline
+int ol_tx_desc_cold_init(struct ol_txrx_pdev_t *pdev, uint16_t pool_size)
+{
+	return 0;
+}
+
+static inline
+void ol_tx_desc_cold_deinit(struct ol_txrx_pdev_t *pdev)
+{
+}
+#endif
+
 enum extension_header_type
 ol_tx_get_ext_header_type(struct ol_txrx_vdev_t *vdev,
 	qdf_nbuf_t netbuf);
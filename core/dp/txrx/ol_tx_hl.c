@@ -117,6 +117,135 @@ ol_tx_desc_pool_size_hl(struct cdp_cfg *ctrl_pdev)
 	return desc_pool_size;
 }
 
+#ifdef QCA_HL_NETDEV_FLOW_CONTROL
+/**
+ * ol_tx_vdev_set_desc_limit() - apply a tx descriptor limit to a vdev
+ * @vdev: the virtual device
+ * @td_limit: new descriptor limit
+ *
+ * Caller must hold pdev->tx_mutex.
+ *
+ * Return: None
+ */
+static void ol_tx_vdev_set_desc_limit(struct ol_txrx_vdev_t *vdev,
+				      int td_limit)
+{
+	vdev->tx_desc_limit = td_limit;
+	vdev->queue_stop_th = td_limit - TXRX_HL_TX_DESC_HI_PRIO_RESERVED;
+	vdev->queue_restart_th = td_limit - TXRX_HL_TX_DESC_QUEUE_RESTART_TH;
+}
+
+#ifdef QCA_HL_TX_ELASTIC_DESC_LIMIT
+/**
+ * ol_tx_elastic_limit_reset() - start a vdev at its minimum budget
+ * @vdev: the virtual device
+ * @max_limit: band/bw specific ceiling for the budget
+ *
+ * Caller must hold pdev->tx_mutex.
+ *
+ * Return: None
+ */
+static void ol_tx_elastic_limit_reset(struct ol_txrx_vdev_t *vdev,
+				      int max_limit)
+{
+	struct ol_tx_elastic_limit *el = &vdev->elastic;
+
+	el->max_limit = max_limit;
+	el->win_start = qdf_system_ticks();
+	el->win_stop_cnt = 0;
+	el->win_peak = 0;
+	el->busy_wins = 0;
+	el->idle_wins = 0;
+	ol_tx_vdev_set_desc_limit(vdev, QDF_MIN(max_limit,
+						OL_TX_ELASTIC_MIN_LIMIT));
+}
+
+/**
+ * ol_tx_elastic_limit_update() - account demand and resize the vdev budget
+ * @vdev: the virtual device
+ * @in_use: number of descriptors currently outstanding on the vdev
+ * @stopped: true if this allocation crossed the stop threshold
+ *
+ * Demand is evaluated lazily, once per OL_TX_ELASTIC_WIN_MS window, on the
+ * allocation path. The budget grows by OL_TX_ELASTIC_CHUNK after
+ * OL_TX_ELASTIC_GROW_WINS windows in a row hit the stop threshold (high
+ * watermark) and shrinks by the same amount after OL_TX_ELASTIC_SHRINK_WINS
+ * windows whose peak stayed below the low watermark. Windows that elapsed
+ * without any allocation count as idle.
+ *
+ * Caller must hold pdev->tx_mutex.
+ *
+ * Return: None
+ */
+static void ol_tx_elastic_limit_update(struct ol_txrx_vdev_t *vdev,
+				       int in_use, bool stopped)
+{
+	struct ol_tx_elastic_limit *el = &vdev->elastic;
+	unsigned long now = qdf_system_ticks();
+	unsigned long win = qdf_system_msecs_to_ticks(OL_TX_ELASTIC_WIN_MS);
+	unsigned long nwin;
+	int low_wm;
+	int new_limit;
+
+	if (in_use > el->win_peak)
+		el->win_peak = in_use;
+	if (stopped)
+		el->win_stop_cnt++;
+
+	if (!win || now - el->win_start < win)
+		return;
+
+	nwin = (now - el->win_start) / win;
+	low_wm = vdev->tx_desc_limit * OL_TX_ELASTIC_LOW_WM_PCT / 100;
+
+	if (el->win_stop_cnt) {
+		el->idle_wins = 0;
+		if (++el->busy_wins >= OL_TX_ELASTIC_GROW_WINS &&
+		    vdev->tx_desc_limit < el->max_limit) {
+			new_limit = QDF_MIN(vdev->tx_desc_limit +
+					    OL_TX_ELASTIC_CHUNK,
+					    el->max_limit);
+			ol_tx_vdev_set_desc_limit(vdev, new_limit);
+			el->grow_cnt++;
+			el->busy_wins = 0;
+		}
+	} else if (!el->win_stop_cnt && el->win_peak < low_wm) {
+		el->busy_wins = 0;
+		el->idle_wins = QDF_MIN(el->idle_wins + nwin,
+					(unsigned long)OL_TX_ELASTIC_SHRINK_WINS);
+		new_limit = vdev->tx_desc_limit - OL_TX_ELASTIC_CHUNK;
+		if (new_limit < OL_TX_ELASTIC_MIN_LIMIT)
+			new_limit = OL_TX_ELASTIC_MIN_LIMIT;
+		if (el->idle_wins >= OL_TX_ELASTIC_SHRINK_WINS &&
+		    new_limit < vdev->tx_desc_limit &&
+		    el->win_peak < new_limit - TXRX_HL_TX_DESC_QUEUE_RESTART_TH) {
+			ol_tx_vdev_set_desc_limit(vdev, new_limit);
+			el->shrink_cnt++;
+			el->idle_wins = 0;
+		}
+	} else {
+		el->busy_wins = 0;
+		el->idle_wins = 0;
+	}
+
+	el->win_start = now;
+	el->win_stop_cnt = 0;
+	el->win_peak = in_use;
+}
+#else
+static inline void ol_tx_elastic_limit_reset(struct ol_txrx_vdev_t *vdev,
+					     int max_limit)
+{
+	ol_tx_vdev_set_desc_limit(vdev, max_limit);
+}
+
+static inline void ol_tx_elastic_limit_update(struct ol_txrx_vdev_t *vdev,
+					      int in_use, bool stopped)
+{
+}
+#endif /* QCA_HL_TX_ELASTIC_DESC_LIMIT */
+#endif /* QCA_HL_NETDEV_FLOW_CONTROL */
+
 #ifdef CONFIG_TX_DESC_HI_PRIO_RESERVE
 
 /**
@@ -189,6 +318,8 @@ struct ol_tx_desc_t *ol_tx_hl_desc_alloc(struct ol_txrx_pdev_t *pdev,
 {
 	struct ol_tx_desc_t *tx_desc =
 			ol_tx_desc_hl(pdev, vdev, msdu, msdu_info);
+	int in_use;
+	bool stopped = false;
 
 	if (!tx_desc)
 		return NULL;
@@ -200,8 +331,9 @@ struct ol_tx_desc_t *ol_tx_hl_desc_alloc(struct ol_txrx_pdev_t *pdev,
 		return tx_desc;
 	}
 
+	in_use = qdf_atomic_read(&vdev->tx_desc_count);
 	if (!qdf_atomic_read(&vdev->os_q_paused) &&
-	    (qdf_atomic_read(&vdev->tx_desc_count) >= vdev->queue_stop_th)) {
+	    (in_use >= vdev->queue_stop_th)) {
 		/*
 		 * Pause normal priority
 		 * netdev queues if tx desc limit crosses
@@ -210,15 +342,16 @@ struct ol_tx_desc_t *ol_tx_hl_desc_alloc(struct ol_txrx_pdev_t *pdev,
 			       WLAN_STOP_NON_PRIORITY_QUEUE,
 			       WLAN_DATA_FLOW_CONTROL);
 		qdf_atomic_set(&vdev->os_q_paused, 1);
+		stopped = true;
 	} else if (ol_tx_desc_is_high_prio(msdu) && !vdev->prio_q_paused &&
-		   (qdf_atomic_read(&vdev->tx_desc_count)
-		   == vdev->tx_desc_limit)) {
+		   (in_use == vdev->tx_desc_limit)) {
 		/* Pause high priority queue */
 		pdev->pause_cb(vdev->vdev_id,
 			       WLAN_NETIF_PRIORITY_QUEUE_OFF,
 			       WLAN_DATA_FLOW_CONTROL_PRIORITY);
 		vdev->prio_q_paused = 1;
 	}
+	ol_tx_elastic_limit_update(vdev, in_use, stopped);
 	qdf_spin_unlock_bh(&pdev->tx_mutex);
 
 	return tx_desc;
@@ -2260,9 +2393,7 @@ int ol_txrx_set_vdev_tx_desc_limit(struct cdp_soc_t *soc_hdl, u8 vdev_id,
 
 	qdf_spin_lock_bh(&vdev->pdev->tx_mutex);
 	td_limit = ol_txrx_tx_desc_alloc_table[fc_limit_id];
-	vdev->tx_desc_limit = td_limit;
-	vdev->queue_stop_th = td_limit - TXRX_HL_TX_DESC_HI_PRIO_RESERVED;
-	vdev->queue_restart_th = td_limit - TXRX_HL_TX_DESC_QUEUE_RESTART_TH;
+	ol_tx_elastic_limit_reset(vdev, td_limit);
 	qdf_spin_unlock_bh(&vdev->pdev->tx_mutex);
 
 	return 0;
@@ -2343,6 +2474,12 @@ void ol_tx_dump_flow_pool_info(struct cdp_soc_t *soc_hdl)
 			       vdev->no_of_bundle_sent_in_timer);
 		txrx_nofl_info("no_of_pkt_not_added_in_queue %lld",
 			       vdev->no_of_pkt_not_added_in_queue);
+#ifdef QCA_HL_TX_ELASTIC_DESC_LIMIT
+		txrx_nofl_info("elastic max_limit %d grow %u shrink %u",
+			       vdev->elastic.max_limit,
+			       vdev->elastic.grow_cnt,
+			       vdev->elastic.shrink_cnt);
+#endif
 	}
 	qdf_spin_unlock_bh(&pdev->tx_mutex);
 }
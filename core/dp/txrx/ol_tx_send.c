@@ -106,12 +106,15 @@ ol_tx_target_credit_incr_int(struct ol_txrx_pdev_t *pdev, int delta)
 #endif
 
 #ifdef DESC_TIMESTAMP_DEBUG_INFO
-static inline void ol_tx_desc_update_comp_ts(struct ol_tx_desc_t *tx_desc)
+static inline void ol_tx_desc_update_comp_ts(struct ol_txrx_pdev_t *pdev,
+					     struct ol_tx_desc_t *tx_desc)
 {
-	tx_desc->desc_debug_info.last_comp_ts = qdf_get_log_timestamp();
+	ol_tx_desc_cold(pdev, tx_desc)->desc_debug_info.last_comp_ts =
+						qdf_get_log_timestamp();
 }
 #else
-static inline void ol_tx_desc_update_comp_ts(struct ol_tx_desc_t *tx_desc)
+static inline void ol_tx_desc_update_comp_ts(struct ol_txrx_pdev_t *pdev,
+					     struct ol_tx_desc_t *tx_desc)
 {
 }
 #endif
@@ -1022,7 +1025,7 @@ ol_tx_completion_handler(ol_txrx_pdev_handle pdev,
 		}
 		tx_desc = ol_tx_desc_find(pdev, tx_desc_id);
 		qdf_assert(tx_desc);
-		ol_tx_desc_update_comp_ts(tx_desc);
+		ol_tx_desc_update_comp_ts(pdev, tx_desc);
 		tx_desc->status = status;
 		netbuf = tx_desc->netbuf;
 
@@ -1099,7 +1102,8 @@ ol_tx_completion_handler(ol_txrx_pdev_handle pdev,
 			if (!is_tx_desc_freed) {
 				tx_desc->pkt_type = ol_tx_frm_freed;
 #ifdef QCA_COMPUTE_TX_DELAY
-				tx_desc->entry_timestamp_ticks = 0xffffffff;
+				ol_tx_desc_cold(pdev, tx_desc)->
+					entry_timestamp_ticks = 0xffffffff;
 #endif
 			}
 #endif
@@ -1380,7 +1384,7 @@ ol_tx_inspect_handler(ol_txrx_pdev_handle pdev,
 		}
 		tx_desc = ol_tx_desc_find(pdev, tx_desc_id);
 		qdf_assert(tx_desc);
-		ol_tx_desc_update_comp_ts(tx_desc);
+		ol_tx_desc_update_comp_ts(pdev, tx_desc);
 		netbuf = tx_desc->netbuf;
 
 		/* find the "vdev" this tx_desc belongs to */
@@ -1411,7 +1415,8 @@ ol_tx_inspect_handler(ol_txrx_pdev_handle pdev,
 			if (!is_tx_desc_freed) {
 				tx_desc->pkt_type = ol_tx_frm_freed;
 #ifdef QCA_COMPUTE_TX_DELAY
-				tx_desc->entry_timestamp_ticks = 0xffffffff;
+				ol_tx_desc_cold(pdev, tx_desc)->
+					entry_timestamp_ticks = 0xffffffff;
 #endif
 			}
 #endif
@@ -1767,8 +1772,8 @@ ol_tx_delay_compute(struct ol_txrx_pdev_t *pdev,
 		uint16_t id = desc_ids[i];
 		struct ol_tx_desc_t *tx_desc = ol_tx_desc_find(pdev, id);
 
-		tx_delay_queue_ticks =
-			now_ticks - tx_desc->entry_timestamp_ticks;
+		tx_delay_queue_ticks = now_ticks -
+			ol_tx_desc_cold(pdev, tx_desc)->entry_timestamp_ticks;
 
 		data->avgs.queue_sum_ticks += tx_delay_queue_ticks;
 		data->avgs.queue_num++;
@@ -565,6 +565,40 @@ ol_txrx_peer_get_ref_by_local_id(struct cdp_pdev *ppdev,
 	return peer;
 }
 
+/**
+ * ol_txrx_peer_get_ref_by_local_id_rcu() - lockless local peer id lookup
+ * @pdev: pdev handle
+ * @local_peer_id: local peer id
+ * @dbg_id: debug id of the reference
+ *
+ * Variant of ol_txrx_peer_get_ref_by_local_id() that takes neither the
+ * peer_ref_mutex nor the local peer id lock. The reference is only taken
+ * if the peer is not already being deleted, so the peer state stays valid
+ * until the caller releases it with @dbg_id.
+ *
+ * Return: referenced peer object or NULL
+ */
+static struct ol_txrx_peer_t *
+ol_txrx_peer_get_ref_by_local_id_rcu(struct ol_txrx_pdev_t *pdev,
+				     uint8_t local_peer_id,
+				     enum peer_debug_id_type dbg_id)
+{
+	struct ol_txrx_peer_t *peer;
+
+	if ((local_peer_id == OL_TXRX_INVALID_LOCAL_PEER_ID) ||
+	    (local_peer_id >= OL_TXRX_NUM_LOCAL_PEER_IDS))
+		return NULL;
+
+	rcu_read_lock();
+	peer = rcu_dereference(pdev->local_peer_ids.map[local_peer_id]);
+	if (peer && (!peer->valid ||
+		     ol_txrx_peer_get_ref_not_zero(peer, dbg_id) <= 0))
+		peer = NULL;
+	rcu_read_unlock();
+
+	return peer;
+}
+
 static void ol_txrx_local_peer_id_pool_init(struct ol_txrx_pdev_t *pdev)
 {
 	int i;
@@ -600,7 +634,7 @@ ol_txrx_local_peer_id_alloc(struct ol_txrx_pdev_t *pdev,
 		/* take the head ID and advance the freelist */
 		peer->local_id = i;
 		pdev->local_peer_ids.freelist = pdev->local_peer_ids.pool[i];
-		pdev->local_peer_ids.map[i] = peer;
+		rcu_assign_pointer(pdev->local_peer_ids.map[i], peer);
 	}
 	qdf_spin_unlock_bh(&pdev->local_peer_ids.lock);
 }
@@ -619,7 +653,7 @@ ol_txrx_local_peer_id_free(struct ol_txrx_pdev_t *pdev,
 	qdf_spin_lock_bh(&pdev->local_peer_ids.lock);
 	pdev->local_peer_ids.pool[i] = pdev->local_peer_ids.freelist;
 	pdev->local_peer_ids.freelist = i;
-	pdev->local_peer_ids.map[i] = NULL;
+	RCU_INIT_POINTER(pdev->local_peer_ids.map[i], NULL);
 	qdf_spin_unlock_bh(&pdev->local_peer_ids.lock);
 }
 
@@ -1182,6 +1216,10 @@ ol_txrx_pdev_post_attach(struct cdp_soc_t *soc_hdl, uint8_t pdev_id)
 	 * desc now, to avoid doing it during time-critical transmit.
 	 */
 	pdev->tx_desc.pool_size = desc_pool_size;
+	ret = ol_tx_desc_cold_init(pdev, desc_pool_size);
+	if (ret)
+		goto cold_alloc_fail;
+
 	pdev->tx_desc.freelist =
 		(union ol_tx_desc_list_elem_t *)
 		(*pdev->tx_desc.desc_pages.cacheable_pages);
@@ -1229,14 +1267,14 @@ ol_txrx_pdev_post_attach(struct cdp_soc_t *soc_hdl, uint8_t pdev_id)
 			c_element->tx_desc.htt_frag_desc = htt_frag_desc;
 			c_element->tx_desc.htt_frag_desc_paddr = frag_paddr;
 		}
+		c_element->tx_desc.id = i;
 #ifdef QCA_SUPPORT_TXDESC_SANITY_CHECKS
 		c_element->tx_desc.pkt_type = 0xff;
 #ifdef QCA_COMPUTE_TX_DELAY
-		c_element->tx_desc.entry_timestamp_ticks =
-			0xffffffff;
+		ol_tx_desc_cold(pdev, &c_element->tx_desc)->
+			entry_timestamp_ticks = 0xffffffff;
 #endif
 #endif
-		c_element->tx_desc.id = i;
 		qdf_atomic_init(&c_element->tx_desc.ref_cnt);
 		c_element = c_element->next;
 		fail_idx = i;
@@ -1413,6 +1451,7 @@ ol_txrx_pdev_post_attach(struct cdp_soc_t *soc_hdl, uint8_t pdev_id)
 	/* initialize mutexes for tx desc alloc and peer lookup */
 	qdf_spinlock_create(&pdev->peer_ref_mutex);
 	qdf_spinlock_create(&pdev->rx.mutex);
+	ol_rx_reorder_array_pool_init(pdev);
 	qdf_spinlock_create(&pdev->last_real_peer_mutex);
 	qdf_spinlock_create(&pdev->peer_map_unmap_lock);
 	OL_TXRX_PEER_STATS_MUTEX_INIT(pdev);
@@ -1561,6 +1600,7 @@ pn_trace_attach_fail:
 
 reorder_trace_attach_fail:
 	qdf_spinlock_destroy(&pdev->peer_ref_mutex);
+	ol_rx_reorder_array_pool_deinit(pdev);
 	qdf_spinlock_destroy(&pdev->rx.mutex);
 	qdf_spinlock_destroy(&pdev->last_real_peer_mutex);
 	qdf_spinlock_destroy(&pdev->peer_map_unmap_lock);
@@ -1572,6 +1612,9 @@ desc_alloc_fail:
 		htt_tx_desc_free(pdev->htt_pdev,
 			(ol_tx_desc_find(pdev, i))->htt_tx_desc);
 
+	ol_tx_desc_cold_deinit(pdev);
+
+cold_alloc_fail:
 	qdf_mem_multi_pages_free(pdev->osdev,
 		&pdev->tx_desc.desc_pages, 0, true);
 
@@ -1756,6 +1799,7 @@ static void ol_txrx_pdev_pre_detach(struct cdp_soc_t *soc_hdl, uint8_t pdev_id,
 	qdf_mem_multi_pages_free(pdev->osdev,
 		&pdev->tx_desc.desc_pages, 0, true);
 	pdev->tx_desc.freelist = NULL;
+	ol_tx_desc_cold_deinit(pdev);
 
 	/* Detach micro controller data path offload resource */
 	if (ol_cfg_ipa_uc_offload_enabled(pdev->ctrl_pdev))
@@ -1766,6 +1810,7 @@ static void ol_txrx_pdev_pre_detach(struct cdp_soc_t *soc_hdl, uint8_t pdev_id,
 
 	qdf_spinlock_destroy(&pdev->peer_ref_mutex);
 	qdf_spinlock_destroy(&pdev->last_real_peer_mutex);
+	ol_rx_reorder_array_pool_deinit(pdev);
 	qdf_spinlock_destroy(&pdev->rx.mutex);
 	qdf_spinlock_destroy(&pdev->peer_map_unmap_lock);
 #ifdef QCA_SUPPORT_TX_THROTTLE
@@ -3134,11 +3179,13 @@ ol_txrx_peer_qoscapable_get(struct ol_txrx_pdev_t *txrx_pdev, uint16_t peer_id)
 
 /**
  * ol_txrx_peer_free_tids() - free tids for the peer
+ * @pdev: pdev handle
  * @peer: peer handle
  *
  * Return: None
  */
-static inline void ol_txrx_peer_free_tids(ol_txrx_peer_handle peer)
+static inline void ol_txrx_peer_free_tids(struct ol_txrx_pdev_t *pdev,
+					  ol_txrx_peer_handle peer)
 {
 	int i = 0;
 	/*
@@ -3153,9 +3200,8 @@ static inline void ol_txrx_peer_free_tids(ol_txrx_peer_handle peer)
 		if (peer->tids_rx_reorder[i].array !=
 		    &peer->tids_rx_reorder[i].base) {
 			ol_txrx_dbg("delete reorder arr, tid:%d", i);
-			qdf_mem_free(peer->tids_rx_reorder[i].array);
-			ol_rx_reorder_init(&peer->tids_rx_reorder[i],
-					   (uint8_t)i);
+			ol_rx_reorder_release_array(pdev,
+						    &peer->tids_rx_reorder[i]);
 		}
 	}
 }
@@ -3286,6 +3332,14 @@ int ol_txrx_peer_release_ref(ol_txrx_peer_handle peer,
 		/* remove the reference to the peer from the hash table */
 		ol_txrx_peer_find_hash_remove(pdev, peer);
 
+		/*
+		 * Unpublish the peer from the peer id maps as well before
+		 * any of its state is torn down. Lockless readers that still
+		 * see it can no longer take a reference, as ref_cnt is 0.
+		 */
+		ol_txrx_peer_clear_map_peer(pdev, peer);
+		ol_txrx_local_peer_id_free(pdev, peer);
+
 		/* remove the peer from its parent vdev's list */
 		TAILQ_REMOVE(&peer->vdev->peer_list, peer, peer_list_elem);
 
@@ -3365,13 +3419,7 @@ int ol_txrx_peer_release_ref(ol_txrx_peer_handle peer,
 
 		ol_txrx_peer_tx_queue_free(pdev, peer);
 
-		/* Remove mappings from peer_id to peer object */
-		ol_txrx_peer_clear_map_peer(pdev, peer);
-
-		/* Remove peer pointer from local peer ID map */
-		ol_txrx_local_peer_id_free(pdev, peer);
-
-		ol_txrx_peer_free_tids(peer);
+		ol_txrx_peer_free_tids(pdev, peer);
 
 		ol_txrx_dump_peer_access_list(peer);
 
@@ -3380,7 +3428,7 @@ int ol_txrx_peer_release_ref(ol_txrx_peer_handle peer,
 			pdev->self_peer = NULL;
 
 		if (!del_rc)
-			qdf_mem_free(peer);
+			ol_txrx_peer_free(peer);
 	} else {
 		access_list = qdf_atomic_read(&peer->access_list[debug_id]);
 		qdf_spin_unlock_bh(&pdev->peer_ref_mutex);
@@ -4979,8 +5027,8 @@ static void ol_rx_data_handler(struct ol_txrx_pdev_t *pdev,
 	/* Do not use peer directly. Derive peer from staid to
 	 * make sure that peer is valid.
 	 */
-	peer = ol_txrx_peer_get_ref_by_local_id((struct cdp_pdev *)pdev,
-			staid, PEER_DEBUG_ID_OL_RX_THREAD);
+	peer = ol_txrx_peer_get_ref_by_local_id_rcu(pdev, staid,
+						    PEER_DEBUG_ID_OL_RX_THREAD);
 	if (!peer)
 		goto free_buf;
 
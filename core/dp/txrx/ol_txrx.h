@@ -117,6 +117,21 @@ ol_tx_desc_pool_size_hl(struct cdp_cfg *ctrl_pdev);
 #define TXRX_HL_TX_DESC_QUEUE_RESTART_TH \
 		(TXRX_HL_TX_DESC_HI_PRIO_RESERVED + 100)
 
+#ifdef QCA_HL_TX_ELASTIC_DESC_LIMIT
+/* Initial (and minimum) per-vdev descriptor budget */
+#define OL_TX_ELASTIC_MIN_LIMIT 400
+/* Budget granted or returned per adjustment */
+#define OL_TX_ELASTIC_CHUNK 200
+/* Length of a demand evaluation window */
+#define OL_TX_ELASTIC_WIN_MS 100
+/* Consecutive busy windows needed before growing */
+#define OL_TX_ELASTIC_GROW_WINS 2
+/* Consecutive idle windows needed before shrinking */
+#define OL_TX_ELASTIC_SHRINK_WINS 20
+/* Peak usage below this percentage of the limit counts as idle */
+#define OL_TX_ELASTIC_LOW_WM_PCT 25
+#endif
+
 struct peer_hang_data {
 	uint16_t tlv_header;
 	uint8_t peer_mac_addr[QDF_MAC_ADDR_SIZE];
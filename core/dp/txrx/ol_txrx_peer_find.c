@@ -83,6 +83,41 @@ int ol_txrx_peer_get_ref(struct ol_txrx_peer_t *peer,
 	return refs_dbg_id;
 }
 
+int ol_txrx_peer_get_ref_not_zero(struct ol_txrx_peer_t *peer,
+				  enum peer_debug_id_type dbg_id)
+{
+	if (dbg_id >= PEER_DEBUG_ID_MAX || dbg_id < 0) {
+		ol_txrx_err("incorrect debug_id %d ", dbg_id);
+		return -EINVAL;
+	}
+
+	if (!qdf_atomic_inc_not_zero(&peer->ref_cnt))
+		return -ENOENT;
+
+	qdf_atomic_inc(&peer->access_list[dbg_id]);
+
+	return qdf_atomic_read(&peer->access_list[dbg_id]);
+}
+
+/**
+ * ol_txrx_peer_free_rcu_cb() - free a peer object after RCU grace period
+ * @head: rcu_head embedded in the peer object
+ *
+ * Return: None
+ */
+static void ol_txrx_peer_free_rcu_cb(struct rcu_head *head)
+{
+	struct ol_txrx_peer_t *peer =
+		container_of(head, struct ol_txrx_peer_t, rcu);
+
+	qdf_mem_free(peer);
+}
+
+void ol_txrx_peer_free(struct ol_txrx_peer_t *peer)
+{
+	call_rcu(&peer->rcu, ol_txrx_peer_free_rcu_cb);
+}
+
 /*=== function definitions for peer MAC addr --> peer object hash table =====*/
 
 /*
@@ -104,12 +139,31 @@ int ol_txrx_peer_get_ref(struct ol_txrx_peer_t *peer,
 #define TXRX_PEER_HASH_LOAD_MULT  2
 #define TXRX_PEER_HASH_LOAD_SHIFT 0
 
+#ifdef QCA_SUPPORT_TXRX_LOCAL_PEER_ID
+/*
+ * Size the peer MAC address -> peer object hash table from the number of
+ * peer objects the host can hold at once (bounded by the local peer id
+ * space) rather than the FW peer id space, which is much larger and mostly
+ * consumed by vdev and multi-id peers.
+ */
+static inline int ol_txrx_peer_find_hash_max_peers(struct ol_txrx_pdev_t *pdev)
+{
+	return QDF_MIN(ol_cfg_max_peer_id(pdev->ctrl_pdev) + 1,
+		       OL_TXRX_NUM_LOCAL_PEER_IDS);
+}
+#else
+static inline int ol_txrx_peer_find_hash_max_peers(struct ol_txrx_pdev_t *pdev)
+{
+	return ol_cfg_max_peer_id(pdev->ctrl_pdev) + 1;
+}
+#endif
+
 static int ol_txrx_peer_find_hash_attach(struct ol_txrx_pdev_t *pdev)
 {
 	int i, hash_elems, log2;
 
 	/* allocate the peer MAC address -> peer object hash table */
-	hash_elems = ol_cfg_max_peer_id(pdev->ctrl_pdev) + 1;
+	hash_elems = ol_txrx_peer_find_hash_max_peers(pdev);
 	hash_elems *= TXRX_PEER_HASH_LOAD_MULT;
 	hash_elems >>= TXRX_PEER_HASH_LOAD_SHIFT;
 	log2 = ol_txrx_log2_ceil(hash_elems);
@@ -117,22 +171,22 @@ static int ol_txrx_peer_find_hash_attach(struct ol_txrx_pdev_t *pdev)
 
 	pdev->peer_hash.mask = hash_elems - 1;
 	pdev->peer_hash.idx_bits = log2;
-	/* allocate an array of TAILQ peer object lists */
+	/* allocate an array of RCU protected peer object lists */
 	pdev->peer_hash.bins =
-		qdf_mem_malloc(hash_elems *
-			       sizeof(TAILQ_HEAD(anonymous_tail_q,
-						 ol_txrx_peer_t)));
+		qdf_mem_malloc(hash_elems * sizeof(*pdev->peer_hash.bins));
 	if (!pdev->peer_hash.bins)
 		return 1;       /* failure */
 
 	for (i = 0; i < hash_elems; i++)
-		TAILQ_INIT(&pdev->peer_hash.bins[i]);
+		INIT_HLIST_HEAD(&pdev->peer_hash.bins[i]);
 
 	return 0;               /* success */
 }
 
 static void ol_txrx_peer_find_hash_detach(struct ol_txrx_pdev_t *pdev)
 {
+	/* wait for the deferred frees of peers still in flight */
+	rcu_barrier();
 	qdf_mem_free(pdev->peer_hash.bins);
 }
 
@@ -165,7 +219,7 @@ ol_txrx_peer_find_hash_add(struct ol_txrx_pdev_t *pdev,
 	 * the same MAC address are stored, the one added first will be
 	 * found first.
 	 */
-	TAILQ_INSERT_TAIL(&pdev->peer_hash.bins[index], peer, hash_list_elem);
+	hlist_add_tail_rcu(&peer->hash_list_elem, &pdev->peer_hash.bins[index]);
 	qdf_spin_unlock_bh(&pdev->peer_ref_mutex);
 }
 
@@ -187,18 +241,20 @@ struct ol_txrx_peer_t *ol_txrx_peer_vdev_find_hash(struct ol_txrx_pdev_t *pdev,
 		mac_addr = &local_mac_addr_aligned;
 	}
 	index = ol_txrx_peer_find_hash_index(pdev, mac_addr);
-	qdf_spin_lock_bh(&pdev->peer_ref_mutex);
-	TAILQ_FOREACH(peer, &pdev->peer_hash.bins[index], hash_list_elem) {
+	rcu_read_lock();
+	hlist_for_each_entry_rcu(peer, &pdev->peer_hash.bins[index],
+				 hash_list_elem) {
 		if (ol_txrx_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) ==
 		    0 && (check_valid == 0 || peer->valid)
-		    && peer->vdev == vdev) {
+		    && peer->vdev == vdev &&
+		    ol_txrx_peer_get_ref_not_zero(peer,
+						  PEER_DEBUG_ID_OL_INTERNAL) > 0) {
 			/* found it */
-			ol_txrx_peer_get_ref(peer, PEER_DEBUG_ID_OL_INTERNAL);
-			qdf_spin_unlock_bh(&pdev->peer_ref_mutex);
+			rcu_read_unlock();
 			return peer;
 		}
 	}
-	qdf_spin_unlock_bh(&pdev->peer_ref_mutex);
+	rcu_read_unlock();
 	return NULL;            /* failure */
 }
 
@@ -222,17 +278,22 @@ struct ol_txrx_peer_t *
 		mac_addr = &local_mac_addr_aligned;
 	}
 	index = ol_txrx_peer_find_hash_index(pdev, mac_addr);
-	qdf_spin_lock_bh(&pdev->peer_ref_mutex);
-	TAILQ_FOREACH(peer, &pdev->peer_hash.bins[index], hash_list_elem) {
+	rcu_read_lock();
+	hlist_for_each_entry_rcu(peer, &pdev->peer_hash.bins[index],
+				 hash_list_elem) {
+		/*
+		 * A peer whose ref count already dropped to zero is being
+		 * deleted; skip it instead of resurrecting it.
+		 */
 		if (ol_txrx_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) ==
-		    0 && (check_valid == 0 || peer->valid)) {
+		    0 && (check_valid == 0 || peer->valid) &&
+		    ol_txrx_peer_get_ref_not_zero(peer, dbg_id) > 0) {
 			/* found it */
-			ol_txrx_peer_get_ref(peer, dbg_id);
-			qdf_spin_unlock_bh(&pdev->peer_ref_mutex);
+			rcu_read_unlock();
 			return peer;
 		}
 	}
-	qdf_spin_unlock_bh(&pdev->peer_ref_mutex);
+	rcu_read_unlock();
 	return NULL;            /* failure */
 }
 
@@ -258,7 +319,7 @@ ol_txrx_peer_find_hash_remove(struct ol_txrx_pdev_t *pdev,
 	 * object reference is removed from the hash table.
 	 */
 	/* qdf_spin_lock_bh(&pdev->peer_ref_mutex); */
-	TAILQ_REMOVE(&pdev->peer_hash.bins[index], peer, hash_list_elem);
+	hlist_del_rcu(&peer->hash_list_elem);
 	/* qdf_spin_unlock_bh(&pdev->peer_ref_mutex); */
 }
 
@@ -271,15 +332,17 @@ void ol_txrx_peer_find_hash_erase(struct ol_txrx_pdev_t *pdev)
 	 */
 
 	for (i = 0; i <= pdev->peer_hash.mask; i++) {
-		if (!TAILQ_EMPTY(&pdev->peer_hash.bins[i])) {
-			struct ol_txrx_peer_t *peer, *peer_next;
+		if (!hlist_empty(&pdev->peer_hash.bins[i])) {
+			struct ol_txrx_peer_t *peer;
+			struct hlist_node *peer_next;
 
 			/*
-			 * TAILQ_FOREACH_SAFE must be used here to avoid any
-			 * memory access violation after peer is freed
+			 * hlist_for_each_entry_safe must be used here to avoid
+			 * any memory access violation after peer is freed
 			 */
-			TAILQ_FOREACH_SAFE(peer, &pdev->peer_hash.bins[i],
-					   hash_list_elem, peer_next) {
+			hlist_for_each_entry_safe(peer, peer_next,
+						  &pdev->peer_hash.bins[i],
+						  hash_list_elem) {
 				/*
 				 * Don't remove the peer from the hash table -
 				 * that would modify the list we are currently
@@ -310,7 +373,7 @@ void ol_txrx_peer_free_inactive_list(struct ol_txrx_pdev_t *pdev)
 		TAILQ_FOREACH_SAFE(peer, &pdev->inactive_peer_list,
 				   inactive_peer_list_elem, tmp) {
 			qdf_atomic_init(&peer->del_ref_cnt); /* set to 0 */
-			qdf_mem_free(peer);
+			ol_txrx_peer_free(peer);
 		}
 	}
 	qdf_spin_unlock_bh(&pdev->peer_map_unmap_lock);
@@ -359,7 +422,7 @@ void ol_txrx_peer_clear_map_peer(ol_txrx_pdev_handle pdev,
 	for (i = 0; i < max_peers; i++) {
 		if (pdev->peer_id_to_obj_map[i].peer == peer) {
 			/* Found a map entry for this peer, clear it. */
-			pdev->peer_id_to_obj_map[i].peer = NULL;
+			RCU_INIT_POINTER(pdev->peer_id_to_obj_map[i].peer, NULL);
 		}
 	}
 	qdf_spin_unlock_bh(&pdev->peer_map_unmap_lock);
@@ -424,7 +487,8 @@ static inline void ol_txrx_peer_find_add_id(struct ol_txrx_pdev_t *pdev,
 	 * peer_find_hash_find
 	 */
 	if (!pdev->peer_id_to_obj_map[peer_id].peer) {
-		pdev->peer_id_to_obj_map[peer_id].peer = peer;
+		rcu_assign_pointer(pdev->peer_id_to_obj_map[peer_id].peer,
+				   peer);
 		qdf_atomic_init
 		  (&pdev->peer_id_to_obj_map[peer_id].peer_id_ref_cnt);
 	}
@@ -664,7 +728,7 @@ void ol_rx_peer_unmap_handler(ol_txrx_pdev_handle pdev, uint16_t peer_id)
 		if (qdf_atomic_dec_and_test(&peer->del_ref_cnt)) {
 			TAILQ_REMOVE(&pdev->inactive_peer_list, peer,
 				     inactive_peer_list_elem);
-			qdf_mem_free(peer);
+			ol_txrx_peer_free(peer);
 		}
 		del_ref_cnt--;
 
@@ -696,7 +760,7 @@ void ol_rx_peer_unmap_handler(ol_txrx_pdev_handle pdev, uint16_t peer_id)
 
 	if (qdf_atomic_dec_and_test
 		(&pdev->peer_id_to_obj_map[peer_id].peer_id_ref_cnt)) {
-		pdev->peer_id_to_obj_map[peer_id].peer = NULL;
+		RCU_INIT_POINTER(pdev->peer_id_to_obj_map[peer_id].peer, NULL);
 		for (i = 0; i < MAX_NUM_PEER_ID_PER_PEER; i++) {
 			if (peer->peer_ids[i] == peer_id) {
 				peer->peer_ids[i] = HTT_INVALID_PEER;
@@ -782,7 +846,7 @@ void ol_txrx_peer_remove_obj_map_entries(ol_txrx_pdev_handle pdev,
 		qdf_atomic_init(&pdev->peer_id_to_obj_map[peer_id].
 				peer_id_ref_cnt);
 		num_deleted_maps += peer_id_ref_cnt;
-		pdev->peer_id_to_obj_map[peer_id].peer = NULL;
+		RCU_INIT_POINTER(pdev->peer_id_to_obj_map[peer_id].peer, NULL);
 		pdev->peer_id_to_obj_map[peer_id].del_peer = peer;
 		peer->peer_ids[i] = HTT_INVALID_PEER;
 	}
@@ -858,11 +922,11 @@ void ol_txrx_peer_find_display(ol_txrx_pdev_handle pdev, int indent)
 	QDF_TRACE(QDF_MODULE_ID_TXRX, QDF_TRACE_LEVEL_INFO_LOW,
 		  "%*speer hash table:\n", indent, " ");
 	for (i = 0; i <= pdev->peer_hash.mask; i++) {
-		if (!TAILQ_EMPTY(&pdev->peer_hash.bins[i])) {
+		if (!hlist_empty(&pdev->peer_hash.bins[i])) {
 			struct ol_txrx_peer_t *peer;
 
-			TAILQ_FOREACH(peer, &pdev->peer_hash.bins[i],
-				      hash_list_elem) {
+			hlist_for_each_entry(peer, &pdev->peer_hash.bins[i],
+					     hash_list_elem) {
 				QDF_TRACE(QDF_MODULE_ID_TXRX,
 					  QDF_TRACE_LEVEL_INFO_LOW,
 					  "%*shash idx %d -> %pK ("QDF_MAC_ADDR_FMT")\n",
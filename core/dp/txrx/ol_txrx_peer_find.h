@@ -42,6 +42,29 @@ int
 ol_txrx_peer_get_ref(struct ol_txrx_peer_t *peer,
 		     enum peer_debug_id_type dbg_id);
 
+/**
+ * ol_txrx_peer_get_ref_not_zero() - get peer reference unless it is dying
+ * @peer: peer object found by a lockless (RCU) lookup
+ * @dbg_id: debug id to keep track of peer references
+ *
+ * Unlike ol_txrx_peer_get_ref(), does not take a reference on a peer whose
+ * ref count already dropped to zero, since such a peer has been (or is
+ * about to be) unlinked and its memory will be freed after the current
+ * RCU grace period.
+ *
+ * Return: peer debug id ref count, or negative error if no ref was taken
+ */
+int ol_txrx_peer_get_ref_not_zero(struct ol_txrx_peer_t *peer,
+				  enum peer_debug_id_type dbg_id);
+
+/**
+ * ol_txrx_peer_free() - free a peer object once lockless readers are done
+ * @peer: peer object already removed from the peer hash table
+ *
+ * Return: None
+ */
+void ol_txrx_peer_free(struct ol_txrx_peer_t *peer);
+
 int ol_txrx_peer_find_attach(struct ol_txrx_pdev_t *pdev);
 
 void ol_txrx_peer_find_detach(struct ol_txrx_pdev_t *pdev);
@@ -90,6 +113,62 @@ struct ol_txrx_peer_t *ol_txrx_peer_find_by_id(struct ol_txrx_pdev_t *pdev,
 	return NULL;
 }
 
+/**
+ * ol_txrx_peer_find_by_id_rcu() - lockless peer_id to peer lookup
+ * @pdev: pdev handle
+ * @peer_id: FW peer id
+ *
+ * Data path variant of ol_txrx_peer_find_by_id(): no lock and no peer
+ * reference are taken. The caller must hold rcu_read_lock(), which only
+ * keeps the peer memory valid; peer objects are freed after an RCU grace
+ * period (see ol_txrx_peer_free()). The peer may be torn down at any time,
+ * so use ol_txrx_peer_get_ref_by_id_rcu() to access its state.
+ *
+ * Return: peer object or NULL
+ */
+static inline struct ol_txrx_peer_t *
+ol_txrx_peer_find_by_id_rcu(struct ol_txrx_pdev_t *pdev, uint16_t peer_id)
+{
+	struct ol_txrx_peer_t *peer;
+
+	if (peer_id > ol_cfg_max_peer_id(pdev->ctrl_pdev))
+		return NULL;
+
+	peer = rcu_dereference(pdev->peer_id_to_obj_map[peer_id].peer);
+	if (peer && peer->valid && qdf_atomic_read(&peer->ref_cnt))
+		return peer;
+
+	return NULL;
+}
+
+/**
+ * ol_txrx_peer_get_ref_by_id_rcu() - lockless peer_id to peer lookup with ref
+ * @pdev: pdev handle
+ * @peer_id: FW peer id
+ * @dbg_id: debug id of the reference
+ *
+ * The peer is found without taking any lock, but a peer reference is
+ * taken before it is returned. The teardown of a peer only starts once
+ * its last reference is released, so the caller can use the peer state
+ * until it calls ol_txrx_peer_release_ref() with @dbg_id.
+ *
+ * Return: referenced peer object or NULL
+ */
+static inline struct ol_txrx_peer_t *
+ol_txrx_peer_get_ref_by_id_rcu(struct ol_txrx_pdev_t *pdev, uint16_t peer_id,
+			       enum peer_debug_id_type dbg_id)
+{
+	struct ol_txrx_peer_t *peer;
+
+	rcu_read_lock();
+	peer = ol_txrx_peer_find_by_id_rcu(pdev, peer_id);
+	if (peer && ol_txrx_peer_get_ref_not_zero(peer, dbg_id) <= 0)
+		peer = NULL;
+	rcu_read_unlock();
+
+	return peer;
+}
+
 void
 ol_txrx_peer_find_hash_add(struct ol_txrx_pdev_t *pdev,
 			   struct ol_txrx_peer_t *peer);
@@ -43,6 +43,7 @@
 #include "cdp_txrx_peer_ops.h"
 #include <qdf_trace.h>
 #include "qdf_hrtimer.h"
+#include <linux/rculist.h>     /* hlist_*_rcu */
 
 /*
  * The target may allocate multiple IDs for a peer.
@@ -155,34 +156,32 @@ struct tx_peer_threshold {
 #endif
 
 
+#if defined(QCA_COMPUTE_TX_DELAY) || defined(DESC_TIMESTAMP_DEBUG_INFO)
+#define OL_TX_DESC_COLD_INFO
+#endif
+
+/*
+ * Size of the leading part of struct ol_tx_desc_t that is accessed for
+ * every frame on the xmit and tx completion paths. Keep it within a
+ * single cache line.
+ */
+#define OL_TX_DESC_HOT_SIZE 64
+
 struct ol_tx_desc_t {
+	/*
+	 * Hot fields - read/written by xmit, HTT download and completion.
+	 * Do not add fields here unless they are touched per frame; see
+	 * the compile time assertions following this structure.
+	 */
 	qdf_nbuf_t netbuf;
 	void *htt_tx_desc;
-	uint16_t id;
 	qdf_dma_addr_t htt_tx_desc_paddr;
 	void *htt_frag_desc; /* struct msdu_ext_desc_t * */
 	qdf_dma_addr_t htt_frag_desc_paddr;
+	struct ol_txrx_vdev_t *vdev;
 	qdf_atomic_t ref_cnt;
 	enum htt_tx_status status;
-
-#ifdef QCA_COMPUTE_TX_DELAY
-	uint32_t entry_timestamp_ticks;
-#endif
-
-#ifdef DESC_TIMESTAMP_DEBUG_INFO
-	struct {
-		uint64_t prev_tx_ts;
-		uint64_t curr_tx_ts;
-		uint64_t last_comp_ts;
-	} desc_debug_info;
-#endif
-
-	/*
-	 * Allow tx descriptors to be stored in (doubly-linked) lists.
-	 * This is mainly used for HL tx queuing and scheduling, but is
-	 * also used by LL+HL for batch processing of tx frames.
-	 */
-	TAILQ_ENTRY(ol_tx_desc_t) tx_desc_list_elem;
+	uint16_t id;
 
 	/*
 	 * Remember whether the tx frame is a regular packet, or whether
@@ -195,10 +194,6 @@ struct ol_tx_desc_t {
 
 	u_int8_t vdev_id;
 
-	struct ol_txrx_vdev_t *vdev;
-
-	void *txq;
-
 #ifdef QCA_SUPPORT_SW_TXRX_ENCAP
 	/*
 	 * used by tx encap, to restore the os buf start offset
@@ -207,6 +202,17 @@ struct ol_tx_desc_t {
 	uint8_t orig_l2_hdr_bytes;
 #endif
 
+	/*
+	 * Warm fields - HL queuing, batch completion, flow pools and TSO.
+	 *
+	 * Allow tx descriptors to be stored in (doubly-linked) lists.
+	 * This is mainly used for HL tx queuing and scheduling, but is
+	 * also used by LL+HL for batch processing of tx frames.
+	 */
+	TAILQ_ENTRY(ol_tx_desc_t) tx_desc_list_elem;
+
+	void *txq;
+
 #ifdef QCA_LL_TX_FLOW_CONTROL_V2
 	struct ol_tx_flow_pool_t *pool;
 #endif
@@ -214,6 +220,97 @@ struct ol_tx_desc_t {
 	void *tso_num_desc;
 };
 
+QDF_COMPILE_TIME_ASSERT(ol_tx_desc_hot_size,
+			offsetof(struct ol_tx_desc_t, tx_desc_list_elem) <=
+			OL_TX_DESC_HOT_SIZE);
+QDF_COMPILE_TIME_ASSERT(ol_tx_desc_size,
+			sizeof(struct ol_tx_desc_t) <=
+			2 * OL_TX_DESC_HOT_SIZE);
+
+#ifdef OL_TX_DESC_COLD_INFO
+/**
+ * struct ol_tx_desc_cold_t - debug/trace state of a tx descriptor
+ * @entry_timestamp_ticks: time the descriptor was allocated, used for
+ *  tx delay histograms
+ * @desc_debug_info: last tx and completion timestamps of the descriptor
+ *
+ * Kept out of struct ol_tx_desc_t in a parallel array indexed by the tx
+ * descriptor id (pdev->tx_desc.cold_array), so that the debug features
+ * do not grow the per frame footprint of the descriptor pool.
+ */
+struct ol_tx_desc_cold_t {
+#ifdef QCA_COMPUTE_TX_DELAY
+	uint32_t entry_timestamp_ticks;
+#endif
+
+#ifdef DESC_TIMESTAMP_DEBUG_INFO
+	struct {
+		uint64_t prev_tx_ts;
+		uint64_t curr_tx_ts;
+		uint64_t last_comp_ts;
+	} desc_debug_info;
+#endif
+};
+#endif
+
+/*
+ * Number of reorder array size classes: one per power of 2 window size
+ * from 1 to 64 (see OL_RX_REORDER_ROUND_PWR2).
+ */
+#define OL_RX_REORDER_ARRAY_NUM_CLASSES 7
+/* Max number of cached free reorder arrays per size class */
+#define OL_RX_REORDER_ARRAY_POOL_DEPTH 8
+
+/**
+ * struct ol_rx_reorder_array_pool - cache of freed rx reorder arrays
+ * @lock: protects the free lists
+ * @freelist: per size class list of free arrays, linked through their
+ *  first element
+ * @num_free: number of arrays on each free list
+ *
+ * Reorder arrays are sized by the block ack window negotiated in ADDBA.
+ * Arrays released by DELBA or peer deletion are parked here per size
+ * class and handed back on the next ADDBA with the same rounded window,
+ * which avoids allocator churn on peer heavy SAP.
+ */
+struct ol_rx_reorder_array_pool {
+	qdf_spinlock_t lock;
+	void *freelist[OL_RX_REORDER_ARRAY_NUM_CLASSES];
+	uint8_t num_free[OL_RX_REORDER_ARRAY_NUM_CLASSES];
+};
+
+#ifdef QCA_HL_TX_ELASTIC_DESC_LIMIT
+/**
+ * struct ol_tx_elastic_limit - demand driven vdev tx descriptor limit state
+ * @max_limit: band/bw specific ceiling the limit may grow up to
+ * @win_start: start of the current demand window, in system ticks
+ * @win_stop_cnt: number of times the vdev hit its stop threshold in the
+ *  current window
+ * @win_peak: peak number of outstanding descriptors in the current window
+ * @busy_wins: consecutive windows in which the stop threshold was hit
+ * @idle_wins: consecutive windows with peak usage below the low watermark
+ * @grow_cnt: number of times the limit has been raised
+ * @shrink_cnt: number of times the limit has been lowered
+ *
+ * The vdev starts with a small tx descriptor budget and is granted
+ * additional chunks only after sustained pressure, so a low throughput
+ * session does not pin a band-sized share of the pool (and the netbufs
+ * attached to it) in the tx queues. The budget is handed back once usage
+ * stays below the low watermark for a while. All fields are protected by
+ * pdev->tx_mutex.
+ */
+struct ol_tx_elastic_limit {
+	int max_limit;
+	unsigned long win_start;
+	uint32_t win_stop_cnt;
+	int win_peak;
+	uint8_t busy_wins;
+	uint8_t idle_wins;
+	uint32_t grow_cnt;
+	uint32_t shrink_cnt;
+};
+#endif /* QCA_HL_TX_ELASTIC_DESC_LIMIT */
+
 typedef TAILQ_HEAD(some_struct_name, ol_tx_desc_t) ol_tx_desc_list;
 
 union ol_tx_desc_list_elem_t {
@@ -542,6 +639,9 @@ struct ol_tx_flow_pool_t {
  *                       after the peer object is deleted on the host.
  *
  * peer_id is used as an index into the array of ol_txrx_peer_id_map.
+ * @peer is RCU published: it is set with rcu_assign_pointer() and may be
+ * read without peer_map_unmap_lock under rcu_read_lock(), see
+ * ol_txrx_peer_get_ref_by_id_rcu().
  */
 struct ol_txrx_peer_id_map {
 	struct ol_txrx_peer_t *peer;
@@ -737,11 +837,16 @@ struct ol_txrx_pdev_t {
 	/* peer ID to peer object map (array of pointers to peer objects) */
 	struct ol_txrx_peer_id_map *peer_id_to_obj_map;
 
+	/*
+	 * Peer MAC address hash table. Bins are RCU protected lists: lookups
+	 * run under rcu_read_lock() only, updates are serialized by
+	 * peer_ref_mutex and peer objects are freed after a grace period.
+	 */
 	struct {
 		unsigned int mask;
 		unsigned int idx_bits;
 
-		TAILQ_HEAD(, ol_txrx_peer_t) * bins;
+		struct hlist_head *bins;
 	} peer_hash;
 
 	/* rx specific processing */
@@ -759,6 +864,7 @@ struct ol_txrx_pdev_t {
 			struct ol_tx_reorder_cat_timeout_t
 				access_cats[TXRX_NUM_WMM_AC];
 		} reorder_timeout;
+		struct ol_rx_reorder_array_pool reorder_array_pool;
 		qdf_spinlock_t mutex;
 	} rx;
 
@@ -804,6 +910,9 @@ struct ol_txrx_pdev_t {
 		uint8_t page_divider;
 		uint32_t offset_filter;
 		struct qdf_mem_multi_page_t desc_pages;
+#ifdef OL_TX_DESC_COLD_INFO
+		struct ol_tx_desc_cold_t *cold_array;
+#endif
 #ifdef DESC_DUP_DETECT_DEBUG
 		unsigned long *free_list_bitmap;
 #endif
@@ -1317,6 +1426,9 @@ struct ol_txrx_vdev_t {
 	int queue_restart_th;
 	int queue_stop_th;
 	int prio_q_paused;
+#ifdef QCA_HL_TX_ELASTIC_DESC_LIMIT
+	struct ol_tx_elastic_limit elastic;
+#endif
 #endif /* QCA_HL_NETDEV_FLOW_CONTROL */
 
 	uint16_t wait_on_peer_id;
@@ -1427,17 +1539,18 @@ struct ol_txrx_cached_bufq_t {
 	uint32_t dropped;
 };
 
+/*
+ * The members of struct ol_txrx_peer_t are grouped by access pattern.
+ * The leading block holds what rx indication / reorder / PN check touch
+ * for every MPDU, so that it spans as few cache lines as possible; the
+ * control path state (list linkage, debug refcounts, tx queues, stats,
+ * last PPDU properties, timers) follows out of that block.
+ */
 struct ol_txrx_peer_t {
+	/* rx/tx fast path block */
 	struct ol_txrx_vdev_t *vdev;
 
-	/* UMAC peer objmgr handle */
-	struct cdp_ctrl_objmgr_peer *ctrl_peer;
-
 	qdf_atomic_t ref_cnt;
-	qdf_atomic_t del_ref_cnt;
-	qdf_atomic_t access_list[PEER_DEBUG_ID_MAX];
-	qdf_atomic_t delete_in_progress;
-	qdf_atomic_t flush_in_progress;
 
 	/* The peer state tracking is used for HL systems
 	 * that don't support tx and rx filtering within the target.
@@ -1449,75 +1562,91 @@ struct ol_txrx_peer_t {
 	 * for all systems.
 	 */
 	enum ol_txrx_peer_state state;
-	qdf_spinlock_t peer_info_lock;
 
-	/* Wrapper around the cached_bufq list */
-	struct ol_txrx_cached_bufq_t bufq_info;
+	/*
+	 * rx proc function: this either is a copy of pdev's rx_opt_proc for
+	 * regular rx processing, or has been redirected to a /dev/null discard
+	 * function when peer deletion is in progress.
+	 */
+	void (*rx_opt_proc)(struct ol_txrx_vdev_t *vdev,
+			    struct ol_txrx_peer_t *peer,
+			    unsigned int tid, qdf_nbuf_t msdu_list);
 
-	ol_tx_filter_func tx_filter;
+	union ol_txrx_align_mac_addr_t mac_addr;
 
-	/* peer ID(s) for this peer */
-	uint16_t peer_ids[MAX_NUM_PEER_ID_PER_PEER];
-#ifdef QCA_SUPPORT_TXRX_LOCAL_PEER_ID
-	uint16_t local_id;
-#endif
+	/* NAWDS Flag and Bss Peer bit */
+	uint16_t nawds_enabled:1, bss_peer:1, valid:1;
 
-	union ol_txrx_align_mac_addr_t mac_addr;
+	/* QoS info */
+	uint8_t qos_capable;
+	/*flag indicating key installed */
+	uint8_t keyinstalled;
 
-	/* node in the vdev's list of peers */
-	TAILQ_ENTRY(ol_txrx_peer_t) peer_list_elem;
-	/* node in the hash table bin's list of peers */
-	TAILQ_ENTRY(ol_txrx_peer_t) hash_list_elem;
-	/* node in the pdev's inactive list of peers */
-	TAILQ_ENTRY(ol_txrx_peer_t)inactive_peer_list_elem;
+	/* Bit to indicate if PN check is done in fw */
+	qdf_atomic_t fw_pn_check;
 
 	/*
 	 * per TID info -
 	 * stored in separate arrays to avoid alignment padding mem overhead
 	 */
-	struct ol_rx_reorder_t tids_rx_reorder[OL_TXRX_NUM_EXT_TIDS];
-	union htt_rx_pn_t tids_last_pn[OL_TXRX_NUM_EXT_TIDS];
 	uint8_t tids_last_pn_valid[OL_TXRX_NUM_EXT_TIDS];
 	uint8_t tids_rekey_flag[OL_TXRX_NUM_EXT_TIDS];
 	uint16_t tids_next_rel_idx[OL_TXRX_NUM_EXT_TIDS];
 	uint16_t tids_last_seq[OL_TXRX_NUM_EXT_TIDS];
 	uint16_t tids_mcast_last_seq[OL_TXRX_NUM_EXT_TIDS];
+	union htt_rx_pn_t tids_last_pn[OL_TXRX_NUM_EXT_TIDS];
 
 	struct {
 		enum htt_sec_type sec_type;
 		uint32_t michael_key[2];        /* relevant for TKIP */
 	} security[2];          /* 0 -> multicast, 1 -> unicast */
 
-	/*
-	 * rx proc function: this either is a copy of pdev's rx_opt_proc for
-	 * regular rx processing, or has been redirected to a /dev/null discard
-	 * function when peer deletion is in progress.
-	 */
-	void (*rx_opt_proc)(struct ol_txrx_vdev_t *vdev,
-			    struct ol_txrx_peer_t *peer,
-			    unsigned int tid, qdf_nbuf_t msdu_list);
+	struct ol_rx_reorder_t tids_rx_reorder[OL_TXRX_NUM_EXT_TIDS];
+
+#ifdef QCA_ENABLE_OL_TXRX_PEER_STATS
+	ol_txrx_peer_stats_t stats;
+#endif
+
+	/* control path block */
+
+	/* UMAC peer objmgr handle */
+	struct cdp_ctrl_objmgr_peer *ctrl_peer;
+
+	qdf_atomic_t del_ref_cnt;
+	qdf_atomic_t access_list[PEER_DEBUG_ID_MAX];
+	qdf_atomic_t delete_in_progress;
+	qdf_atomic_t flush_in_progress;
+
+	qdf_spinlock_t peer_info_lock;
+
+	/* Wrapper around the cached_bufq list */
+	struct ol_txrx_cached_bufq_t bufq_info;
+
+	ol_tx_filter_func tx_filter;
+
+	/* peer ID(s) for this peer */
+	uint16_t peer_ids[MAX_NUM_PEER_ID_PER_PEER];
+#ifdef QCA_SUPPORT_TXRX_LOCAL_PEER_ID
+	uint16_t local_id;
+#endif
+
+	/* node in the vdev's list of peers */
+	TAILQ_ENTRY(ol_txrx_peer_t) peer_list_elem;
+	/* node in the hash table bin's list of peers (RCU protected) */
+	struct hlist_node hash_list_elem;
+	/* deferred free of the peer object after an RCU grace period */
+	struct rcu_head rcu;
+	/* node in the pdev's inactive list of peers */
+	TAILQ_ENTRY(ol_txrx_peer_t)inactive_peer_list_elem;
 
 #if defined(CONFIG_HL_SUPPORT)
 	struct ol_tx_frms_queue_t txqs[OL_TX_NUM_TIDS];
 #endif
 
-#ifdef QCA_ENABLE_OL_TXRX_PEER_STATS
-	ol_txrx_peer_stats_t stats;
-#endif
 	int16_t rssi_dbm;
 
-	/* NAWDS Flag and Bss Peer bit */
-	uint16_t nawds_enabled:1, bss_peer:1, valid:1;
-
-	/* QoS info */
-	uint8_t qos_capable;
 	/* U-APSD tid mask */
 	uint8_t uapsd_mask;
-	/*flag indicating key installed */
-	uint8_t keyinstalled;
-
-	/* Bit to indicate if PN check is done in fw */
-	qdf_atomic_t fw_pn_check;
 
 	/* PN counter for Robust Management Frames */
 	uint64_t last_rmf_pn;
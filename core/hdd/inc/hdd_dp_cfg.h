@@ -753,6 +753,110 @@
 		false, \
 		"Control to enable latency critical clients")
 
+/*
+ * <ini>
+ * gBusBandwidthPredictiveVote - Select predictive bus bandwidth voting
+ * @Default: false
+ *
+ * This ini selects the predictive throughput level controller in the bus
+ * bandwidth timer instead of the plain per-interval threshold compare. The
+ * predictive controller keeps an EWMA of the packet count and its trend,
+ * raises the level as soon as the projected count crosses a threshold and
+ * lowers it only after gBusBandwidthDownHysteresis quiet intervals. It also
+ * enables immediate escalation from the data path when tx flow control
+ * pauses a netdev queue or an rx chain exceeds gBusBandwidthEscalateThreshold.
+ *
+ * Supported Feature: Bus bandwidth voting
+ *
+ * Usage: Internal
+ *
+ * </ini>
+ */
+#define CFG_DP_BUS_BANDWIDTH_PREDICTIVE_VOTE \
+		CFG_INI_BOOL( \
+		"gBusBandwidthPredictiveVote", \
+		false, \
+		"Control to enable predictive bus bandwidth voting")
+
+/*
+ * <ini>
+ * gBusBandwidthDownHysteresis - Intervals to wait before lowering the level
+ * @Min: 0
+ * @Max: 100
+ * @Default: 3
+ *
+ * This ini specifies the number of consecutive bus bandwidth compute
+ * intervals the predicted throughput level has to stay below the current
+ * level before the predictive controller lowers the vote.
+ *
+ * Supported Feature: Bus bandwidth voting
+ *
+ * Usage: Internal
+ *
+ * </ini>
+ */
+#define CFG_DP_BUS_BANDWIDTH_DOWN_HYSTERESIS \
+		CFG_INI_UINT( \
+		"gBusBandwidthDownHysteresis", \
+		0, \
+		100, \
+		3, \
+		CFG_VALUE_OR_DEFAULT, \
+		"Bus bandwidth predictive vote down hysteresis")
+
+/*
+ * <ini>
+ * gBusBandwidthEscalateThreshold - Rx chain length to escalate the bus vote
+ * @Min: 0
+ * @Max: 4096
+ * @Default: 128
+ *
+ * This ini specifies the number of frames delivered to HDD in a single rx
+ * indication above which the predictive controller escalates the bus
+ * bandwidth vote right away instead of waiting for the next compute
+ * interval. 0 disables rx triggered escalation.
+ *
+ * Supported Feature: Bus bandwidth voting
+ *
+ * Usage: Internal
+ *
+ * </ini>
+ */
+#define CFG_DP_BUS_BANDWIDTH_ESCALATE_THRESHOLD \
+		CFG_INI_UINT( \
+		"gBusBandwidthEscalateThreshold", \
+		0, \
+		4096, \
+		128, \
+		CFG_VALUE_OR_DEFAULT, \
+		"Bus bandwidth predictive vote rx escalate threshold")
+
+/*
+ * <ini>
+ * gTcpRxAdaptiveTuning - Control to enable adaptive TCP rx parameter tuning
+ * @Default: false
+ *
+ * This ini is used to derive the TCP delayed ack segment count from the
+ * measured rx rate and the RTT of local TCP flows seen in the rx path, and
+ * to pick the low or high adv window scale from the bandwidth delay product
+ * at the link PHY rate, instead of switching both on the rx level. Values
+ * are only conveyed through the vendor event, hence enable_tcp_param_update
+ * is required as well.
+ *
+ * Related: gTcpDelAckEnable, gTcpAdvWinScaleEnable
+ *
+ * Supported Feature: Tcp Delayed Ack, Tcp Advance Window Scaling
+ *
+ * Usage: Internal
+ *
+ * </ini>
+ */
+#define CFG_DP_TCP_RX_ADAPTIVE_TUNING \
+		CFG_INI_BOOL( \
+		"gTcpRxAdaptiveTuning", \
+		false, \
+		"Control to enable adaptive TCP rx parameter tuning")
+
 #endif /*WLAN_FEATURE_DP_BUS_BANDWIDTH*/
 
 #ifdef QCA_SUPPORT_TXRX_DRIVER_TCP_DEL_ACK
@@ -1024,6 +1128,33 @@
 		"e", \
 		"specify RPS map for different RX queus")
 
+/*
+ * <ini>
+ * gRpsFlowSteering - Steer rx of a flow toward the CPU consuming it
+ * @Default: false
+ *
+ * This ini enables per flow RPS steering. The CPU a local socket transmits
+ * from is learned per TCP/UDP flow on tx, and rx frames of that flow are
+ * recorded on the rx queue whose rpsRxQueueCpuMapList mask is the narrowest
+ * one containing that CPU, so RPS processes them where the application
+ * runs. Queue 0 keeps carrying all other traffic, hence the rx queues 1 and
+ * above need single CPU (or small) masks for the steering to take effect,
+ * e.g. rpsRxQueueCpuMapList=e 2 4 8 10.
+ *
+ * Related: rpsRxQueueCpuMapList
+ *
+ * Supported Feature: Rx_thread
+ *
+ * Usage: Internal
+ *
+ * </ini>
+ */
+#define CFG_DP_RPS_FLOW_STEERING \
+		CFG_INI_BOOL( \
+		"gRpsFlowSteering", \
+		false, \
+		"Steer rx of a flow to the CPU of its consumer")
+
 /*
  * <ini>
  * gEnableTxOrphan- Enable/Disable orphaning of Tx packets
@@ -1493,7 +1624,11 @@
 	CFG(CFG_DP_TCP_DELACK_TIMER_COUNT) \
 	CFG(CFG_DP_TCP_TX_HIGH_TPUT_THRESHOLD) \
 	CFG(CFG_DP_BUS_LOW_BW_CNT_THRESHOLD) \
-	CFG(CFG_DP_BUS_HANDLE_LATENCY_CRITICAL_CLIENTS)
+	CFG(CFG_DP_BUS_HANDLE_LATENCY_CRITICAL_CLIENTS) \
+	CFG(CFG_DP_BUS_BANDWIDTH_PREDICTIVE_VOTE) \
+	CFG(CFG_DP_BUS_BANDWIDTH_DOWN_HYSTERESIS) \
+	CFG(CFG_DP_BUS_BANDWIDTH_ESCALATE_THRESHOLD) \
+	CFG(CFG_DP_TCP_RX_ADAPTIVE_TUNING)
 
 #else
 #define CFG_HDD_DP_BUS_BANDWIDTH
@@ -1525,6 +1660,7 @@
 	CFG(CFG_DP_RX_THREAD_CPU_MASK) \
 	CFG(CFG_DP_RX_THREAD_UL_CPU_MASK) \
 	CFG(CFG_DP_RPS_RX_QUEUE_CPU_MAP_LIST) \
+	CFG(CFG_DP_RPS_FLOW_STEERING) \
 	CFG(CFG_DP_TX_ORPHAN_ENABLE) \
 	CFG(CFG_DP_RX_MODE) \
 	CFG(CFG_DP_TX_COMP_LOOP_PKT_LIMIT)\
@@ -173,6 +173,10 @@ struct hdd_config {
 	bool     enable_tcp_param_update;
 	uint32_t bus_low_cnt_threshold;
 	bool enable_latency_crit_clients;
+	bool bus_bw_predictive_vote;
+	uint32_t bus_bw_down_hysteresis;
+	uint32_t bus_bw_escalate_threshold;
+	bool tcp_rx_adaptive_tuning;
 #endif /*WLAN_FEATURE_DP_BUS_BANDWIDTH*/
 
 #ifdef WLAN_FEATURE_MSCS
@@ -204,6 +208,7 @@ struct hdd_config {
 	uint32_t rx_thread_ul_affinity_mask;
 	uint32_t rx_thread_affinity_mask;
 	uint8_t cpu_map_list[CFG_DP_RPS_RX_QUEUE_CPU_MAP_LIST_LEN];
+	bool rps_flow_steering;
 	bool multicast_replay_filter;
 	uint32_t rx_wakelock_timeout;
 	uint8_t num_dp_rx_threads;
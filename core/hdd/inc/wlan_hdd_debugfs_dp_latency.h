@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021 The Linux Foundation. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: wlan_hdd_debugfs_dp_latency.h
+ *
+ * WLAN Host Device Driver implementation to create debugfs
+ * dp_latency
+ */
+
+#ifndef _WLAN_HDD_DEBUGFS_DP_LATENCY_H
+#define _WLAN_HDD_DEBUGFS_DP_LATENCY_H
+
+#ifdef WLAN_DP_LATENCY_DEBUGFS
+/**
+ * hdd_debugfs_dp_latency_init() - Create the data path latency debugfs
+ * @hdd_ctx: Pointer to the hdd_ctx
+ *
+ * this file is created per driver.
+ * file path:  /sys/kernel/debug/wlan_xx/dp_latency
+ *                (wlan_xx is driver name)
+ * usage:
+ *      echo 1024 > dp_latency    sample 1 in 1024 data path events
+ *      echo 0 > dp_latency       stop sampling
+ *      echo reset > dp_latency   clear the histograms
+ *      cat dp_latency
+ *
+ * Return: None
+ */
+void hdd_debugfs_dp_latency_init(struct hdd_context *hdd_ctx);
+#else
+static inline void hdd_debugfs_dp_latency_init(struct hdd_context *hdd_ctx)
+{
+}
+#endif
+#endif /* _WLAN_HDD_DEBUGFS_DP_LATENCY_H */
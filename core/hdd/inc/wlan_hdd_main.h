@@ -562,6 +562,237 @@ struct hdd_tx_rx_histogram {
 	uint64_t qtime;
 };
 
+/**
+ * struct hdd_bus_bw_thresholds - packet count thresholds per bus bw
+ *  compute interval used to select the throughput level
+ * @very_high: threshold for TPUT_LEVEL_VERY_HIGH
+ * @high: threshold for TPUT_LEVEL_HIGH
+ * @medium: threshold for TPUT_LEVEL_MEDIUM
+ * @low: threshold for TPUT_LEVEL_LOW
+ */
+struct hdd_bus_bw_thresholds {
+	uint32_t very_high;
+	uint32_t high;
+	uint32_t medium;
+	uint32_t low;
+};
+
+#ifdef WLAN_SYSFS_BUS_BW_TRACE
+#define HDD_BUS_BW_TRACE_SIZE 32
+
+/**
+ * struct hdd_bus_bw_trace_rec - inputs and outputs of one bus bw compute
+ *  interval
+ * @qtime: timestamp when the record is added
+ * @tx_packets: tx packets in the interval
+ * @rx_packets: rx packets in the interval
+ * @no_tx_offload_pkts: tx packets in the interval not using TSO
+ * @no_rx_offload_pkts: rx packets in the interval not using LRO/GRO
+ * @tput_level: throughput level selected for the interval
+ * @vote_level: pld_bus_width_type selected for the interval
+ * @rx_level: tcp rx tuning level after the interval
+ * @tx_level: tcp tx tuning level after the interval
+ * @bbm_vote: bus bw level voted by the bus bw manager
+ * @policy_vote: bus bw manager per policy votes
+ * @tput_policy_vote: tput policy vote the connection modes of the interval
+ *  give for each throughput level
+ *
+ * Unlike struct hdd_tx_rx_histogram an entry is added for every interval so
+ * that the threshold stage and the BBM policies can be replayed against it.
+ */
+struct hdd_bus_bw_trace_rec {
+	uint64_t qtime;
+	uint64_t tx_packets;
+	uint64_t rx_packets;
+	uint64_t no_tx_offload_pkts;
+	uint64_t no_rx_offload_pkts;
+	uint8_t tput_level;
+	uint8_t vote_level;
+	uint8_t rx_level;
+	uint8_t tx_level;
+	uint8_t bbm_vote;
+	uint8_t policy_vote[BBM_MAX_POLICY];
+	uint8_t tput_policy_vote[TPUT_LEVEL_MAX];
+};
+
+/**
+ * struct hdd_bus_bw_trace - ring of bus bw compute interval records
+ * @rec: records
+ * @idx: index of the next record to write
+ * @count: number of valid records
+ * @replay: replay the ring against @replay_thres when it is read
+ * @replay_thres: thresholds to replay the ring with
+ */
+struct hdd_bus_bw_trace {
+	struct hdd_bus_bw_trace_rec rec[HDD_BUS_BW_TRACE_SIZE];
+	uint32_t idx;
+	uint32_t count;
+	bool replay;
+	struct hdd_bus_bw_thresholds replay_thres;
+};
+#endif
+
+/* Flow to CPU slots learned per adapter for RPS flow steering */
+#define HDD_RPS_FLOW_TBL_SIZE 64
+/* A learned flow is used for steering until it has been idle this long */
+#define HDD_RPS_FLOW_AGE_MS 2000
+
+/**
+ * struct hdd_rps_flow - consumer CPU of a flow learned on tx
+ * @key: direction independent flow key, 0 if the slot is unused
+ * @cpu: CPU the local socket of the flow last transmitted from
+ * @last_seen: system ticks of the last update
+ *
+ * Slots are written on tx and read on rx without locking. A torn read can
+ * only steer a frame to another valid rx queue, which is harmless.
+ */
+struct hdd_rps_flow {
+	uint32_t key;
+	uint32_t cpu;
+	unsigned long last_seen;
+};
+
+#ifdef WLAN_FEATURE_DP_BUS_BANDWIDTH
+/* TCP timestamp probes per adapter for the rx RTT estimate */
+#define HDD_TCP_RTT_PROBE_TBL_SIZE 16
+/* A probe whose timestamp was never echoed is re-armed after this long */
+#define HDD_TCP_RTT_PROBE_AGE_MS 1000
+
+/**
+ * struct hdd_tcp_rtt_probe - TCP timestamp sent by a local flow
+ * @key: direction independent flow key, 0 if the probe is not armed
+ * @tsval: TSval of the probed segment
+ * @sent_us: time the segment was transmitted in usecs
+ *
+ * Probes are armed on tx and matched against the TSecr of rx segments
+ * without locking. A torn read yields one outlier sample at worst, which
+ * the RTT filter absorbs.
+ */
+struct hdd_tcp_rtt_probe {
+	uint32_t key;
+	uint32_t tsval;
+	uint64_t sent_us;
+};
+
+/**
+ * struct hdd_tcp_rx_tune - adaptive TCP rx parameter controller state
+ * @srtt_us: smoothed RTT of local TCP rx flows in usecs scaled by 8,
+ *           0 if not sampled yet
+ * @rtt_samples: number of RTT samples taken
+ * @rx_pps: rx packet rate of the last compute interval
+ * @pkts_per_rtt: rx segments per RTT of the last compute interval
+ * @phy_rate: rx PHY rate of the fastest connected link in Mbps
+ * @delack_seg: delayed ack segment count in effect, 0 if not tuned
+ * @win_scale: adv window scale in effect, 0 if not tuned
+ * @updates: number of parameter updates sent
+ * @qtime: log timestamp of the last parameter update
+ *
+ * @srtt_us and @rtt_samples are updated from the rx path, the remaining
+ * fields by the bus bw work under bus_bw_lock.
+ */
+struct hdd_tcp_rx_tune {
+	uint32_t srtt_us;
+	uint32_t rtt_samples;
+	uint64_t rx_pps;
+	uint64_t pkts_per_rtt;
+	uint32_t phy_rate;
+	uint32_t delack_seg;
+	uint32_t win_scale;
+	uint32_t updates;
+	uint64_t qtime;
+};
+#endif
+
+/**
+ * enum hdd_dp_lat_stage - data path stages timed by the latency probe
+ * @HDD_DP_LAT_RX_STACK: one frame handed to the network stack
+ * @HDD_DP_LAT_RX_CHAIN: rx indication to HDD until its frames are delivered
+ * @HDD_DP_LAT_TX_DP: xmit entry until the frame is accepted for download
+ * @HDD_DP_LAT_TX_COMP: xmit entry until the tx completion of the frame
+ * @HDD_DP_LAT_STAGE_MAX: number of stages
+ */
+enum hdd_dp_lat_stage {
+	HDD_DP_LAT_RX_STACK,
+	HDD_DP_LAT_RX_CHAIN,
+	HDD_DP_LAT_TX_DP,
+	HDD_DP_LAT_TX_COMP,
+	HDD_DP_LAT_STAGE_MAX
+};
+
+#ifdef WLAN_DP_LATENCY_DEBUGFS
+/* Log2 usec latency bins, the last one collects everything above */
+#define HDD_DP_LAT_NUM_BINS 16
+/* Sampled tx frames awaiting their completion */
+#define HDD_DP_LAT_TX_SLOTS 64
+/* Samples above this are stale slots or clock jumps and are dropped */
+#define HDD_DP_LAT_MAX_US (1000 * 1000)
+
+/**
+ * struct hdd_dp_lat_hist - latency histogram of one stage
+ * @count: number of samples
+ * @max_us: largest sample in usecs
+ * @sum_us: sum of the samples in usecs
+ * @bin: sample count per log2 usec bin
+ */
+struct hdd_dp_lat_hist {
+	uint32_t count;
+	uint32_t max_us;
+	uint64_t sum_us;
+	uint32_t bin[HDD_DP_LAT_NUM_BINS];
+};
+
+/**
+ * struct hdd_dp_lat_cpu - per-CPU latency probe area
+ * @seq: sampling sequence of the CPU
+ * @hist: histogram per stage
+ *
+ * Only the owning CPU writes its area, readers sum over all CPUs.
+ */
+struct hdd_dp_lat_cpu {
+	uint32_t seq;
+	struct hdd_dp_lat_hist hist[HDD_DP_LAT_STAGE_MAX];
+} ____cacheline_aligned_in_smp;
+
+/**
+ * struct hdd_dp_lat_tx_slot - sampled tx frame awaiting completion
+ * @nbuf: sampled frame, NULL if the slot is free
+ * @start_us: xmit entry time of the frame in usecs
+ */
+struct hdd_dp_lat_tx_slot {
+	qdf_nbuf_t nbuf;
+	uint64_t start_us;
+};
+#endif
+
+/**
+ * struct hdd_rx_cpu_stats - per-CPU rx counters of an adapter
+ * @rx_packets: frames indicated to HDD
+ * @rx_dropped: frames dropped by HDD
+ * @rx_delivered: frames accepted by the network stack
+ * @rx_refused: frames refused by the network stack
+ * @rx_usolict_arp_n_mcast_drp: unsolicited arp/na and replayed mcast drops
+ * @rx_aggregated: frames consumed by rx offload
+ * @rx_gro_dropped: frames dropped by rx offload
+ * @rx_non_aggregated: frames delivered without rx offload
+ * @rx_gro_flush_skip: gro flush indications skipped for low tput
+ * @rx_gro_low_tput_flush: extra gro flushes done at idle bus level
+ *
+ * The counters are bumped for every rx frame, each CPU only writes its
+ * own cache line and readers sum over all CPUs.
+ */
+struct hdd_rx_cpu_stats {
+	__u32 rx_packets;
+	__u32 rx_dropped;
+	__u32 rx_delivered;
+	__u32 rx_refused;
+	__u32 rx_usolict_arp_n_mcast_drp;
+	__u32 rx_aggregated;
+	__u32 rx_gro_dropped;
+	__u32 rx_non_aggregated;
+	__u32 rx_gro_flush_skip;
+	__u32 rx_gro_low_tput_flush;
+} ____cacheline_aligned_in_smp;
+
 struct hdd_tx_rx_stats {
 	/* start_xmit stats */
 	__u32    tx_called;
@@ -570,19 +801,8 @@ struct hdd_tx_rx_stats {
 	__u32    tx_classified_ac[NUM_TX_QUEUES];
 	__u32    tx_dropped_ac[NUM_TX_QUEUES];
 
-	/* rx stats */
-	__u32 rx_packets[NUM_CPUS];
-	__u32 rx_dropped[NUM_CPUS];
-	__u32 rx_delivered[NUM_CPUS];
-	__u32 rx_refused[NUM_CPUS];
-	qdf_atomic_t rx_usolict_arp_n_mcast_drp;
-
-	/* rx gro */
-	__u32 rx_aggregated;
-	__u32 rx_gro_dropped;
-	__u32 rx_non_aggregated;
-	__u32 rx_gro_flush_skip;
-	__u32 rx_gro_low_tput_flush;
+	/* rx stats, see hdd_get_rx_cpu_stats_sum() */
+	struct hdd_rx_cpu_stats rx_cpu[NUM_CPUS];
 
 	/* txflow stats */
 	bool     is_txflow_paused;
@@ -1108,12 +1328,14 @@ struct hdd_multicast_addr_list {
 	uint8_t addr[WLAN_HDD_MAX_MC_ADDR_LIST][ETH_ALEN];
 };
 
-#define WLAN_HDD_MAX_HISTORY_ENTRY 25
+/* netif queue history entries kept per CPU, must be a power of 2 */
+#define WLAN_HDD_MAX_HISTORY_ENTRY 16
 
 /**
  * struct hdd_netif_queue_stats - netif queue operation statistics
  * @pause_count - pause counter
  * @unpause_count - unpause counter
+ * @total_pause_time - time the queues were kept paused by the reason
  */
 struct hdd_netif_queue_stats {
 	u32 pause_count;
@@ -1137,6 +1359,24 @@ struct hdd_netif_queue_history {
 	unsigned long tx_q_state[NUM_TX_QUEUES];
 };
 
+/**
+ * struct hdd_netif_queue_cpu_history - per-CPU netif queue operation log
+ * @index: number of operations logged by the CPU
+ * @pause_count: pause counter per reason
+ * @unpause_count: unpause counter per reason
+ * @entry: ring of the latest operations logged by the CPU
+ *
+ * Only the owning CPU writes its log, with bottom halves disabled, so
+ * recording an operation does not take any lock. Readers merge the logs
+ * of all CPUs.
+ */
+struct hdd_netif_queue_cpu_history {
+	qdf_atomic_t index;
+	u32 pause_count[WLAN_REASON_TYPE_MAX];
+	u32 unpause_count[WLAN_REASON_TYPE_MAX];
+	struct hdd_netif_queue_history entry[WLAN_HDD_MAX_HISTORY_ENTRY];
+} ____cacheline_aligned_in_smp;
+
 /**
  * struct hdd_chan_change_params - channel related information
  * @chan_freq: operating channel frequency
@@ -1229,6 +1469,8 @@ struct hdd_context;
  * @delete_in_progress: Flag to indicate that the adapter delete is in
  *			progress, and any operation using rtnl lock inside
  *			the driver can be avoided/skipped.
+ * @tdls_ct_batch: per-CPU TDLS connection tracker counts, flushed to the
+ *		   TDLS component once per tracker period
  */
 struct hdd_adapter {
 	/* Magic cookie for adapter sanity verification.  Note that this
@@ -1460,10 +1702,10 @@ struct hdd_adapter {
 	qdf_time_t last_time;
 	qdf_time_t total_pause_time;
 	qdf_time_t total_unpause_time;
-	uint8_t history_index;
-	struct hdd_netif_queue_history
-		 queue_oper_history[WLAN_HDD_MAX_HISTORY_ENTRY];
-	struct hdd_netif_queue_stats queue_oper_stats[WLAN_REASON_TYPE_MAX];
+	/* per reason pause accounting, protected by pause_map_lock */
+	qdf_time_t reason_pause_start[WLAN_REASON_TYPE_MAX];
+	qdf_time_t reason_pause_time[WLAN_REASON_TYPE_MAX];
+	struct hdd_netif_queue_cpu_history queue_oper_history[NUM_CPUS];
 	ol_txrx_tx_fp tx_fn;
 	/* debugfs entry */
 	struct dentry *debugfs_phy;
@@ -1544,6 +1786,16 @@ struct hdd_adapter {
 #ifdef WLAN_FEATURE_BIG_DATA_STATS
 	struct big_data_stats_event big_data_stats;
 #endif
+#ifdef FEATURE_WLAN_TDLS
+	struct hdd_tdls_ct_batch tdls_ct_batch[NUM_CPUS];
+#endif
+	/* rps flow steering state and its rx queue per CPU, 0 if none */
+	bool rps_flow_steering;
+	uint8_t rps_cpu_rxq[NUM_CPUS];
+	struct hdd_rps_flow rps_flow_tbl[HDD_RPS_FLOW_TBL_SIZE];
+#ifdef WLAN_FEATURE_DP_BUS_BANDWIDTH
+	struct hdd_tcp_rtt_probe tcp_rtt_probe[HDD_TCP_RTT_PROBE_TBL_SIZE];
+#endif
 };
 
 #define WLAN_HDD_GET_STATION_CTX_PTR(adapter) (&(adapter)->session.station)
@@ -1958,6 +2210,21 @@ struct hdd_context {
 	uint64_t prev_tx;
 	qdf_atomic_t low_tput_gro_enable;
 	uint32_t bus_low_vote_cnt;
+	/* predictive bus bw vote state, protected by bus_bw_lock */
+	uint64_t bus_bw_ewma;
+	uint64_t bus_bw_prev_total;
+	uint32_t bus_bw_down_cnt;
+	enum tput_level bus_bw_pred_level;
+	qdf_atomic_t bus_bw_escalate_pending;
+	/* escalations are only voted while the bus bw timer runs */
+	qdf_atomic_t bus_bw_escalate_active;
+	bool bus_bw_escalate_work_init;
+	qdf_work_t bus_bw_escalate_work;
+	struct hdd_tcp_rx_tune tcp_rx_tune;
+#ifdef WLAN_SYSFS_BUS_BW_TRACE
+	/* per interval bus bw trace, protected by bus_bw_lock */
+	struct hdd_bus_bw_trace bus_bw_trace;
+#endif
 #endif /*WLAN_FEATURE_DP_BUS_BANDWIDTH*/
 
 	struct completion ready_to_suspend;
@@ -2074,6 +2341,12 @@ struct hdd_context {
 	struct qdf_delayed_work psoc_idle_timeout_work;
 	bool rps;
 	bool dynamic_rps;
+#ifdef WLAN_DP_LATENCY_DEBUGFS
+	/* 1-in-N data path latency sampling, N is a power of 2, 0 if off */
+	uint32_t dp_lat_sample_rate;
+	struct hdd_dp_lat_cpu dp_lat[NUM_CPUS];
+	struct hdd_dp_lat_tx_slot dp_lat_tx[HDD_DP_LAT_TX_SLOTS];
+#endif
 	bool enable_rxthread;
 	/* support for DP RX threads */
 	bool enable_dp_rx_threads;
@@ -3032,6 +3305,50 @@ int hdd_bus_bandwidth_init(struct hdd_context *hdd_ctx);
  */
 void hdd_bus_bandwidth_deinit(struct hdd_context *hdd_ctx);
 
+/**
+ * hdd_bus_bw_escalate() - Request an immediate bus bandwidth escalation
+ * @hdd_ctx: HDD context
+ *
+ * Called from the data path when tx/rx backlog indicates the current bus
+ * vote cannot keep up. When predictive voting is enabled the vote is raised
+ * by one throughput level from process context without waiting for the
+ * next bus bandwidth compute interval. Safe to call from atomic context.
+ *
+ * Return: None
+ */
+void hdd_bus_bw_escalate(struct hdd_context *hdd_ctx);
+
+/**
+ * hdd_bus_bw_thres_to_tput_level() - Select the throughput level for a
+ *  bus bw compute interval
+ * @thres: packet count thresholds
+ * @pkts: tx + rx packets in the interval
+ *
+ * This is the threshold stage of the bus bandwidth timer, shared with the
+ * bus bw trace replay.
+ *
+ * Return: throughput level
+ */
+enum tput_level
+hdd_bus_bw_thres_to_tput_level(const struct hdd_bus_bw_thresholds *thres,
+			       uint64_t pkts);
+
+/**
+ * hdd_bus_bw_check_rx_backlog() - Escalate the bus vote on a long rx chain
+ * @hdd_ctx: HDD context
+ * @rx_frames: number of frames delivered in one rx indication
+ *
+ * Return: None
+ */
+static inline void
+hdd_bus_bw_check_rx_backlog(struct hdd_context *hdd_ctx, uint32_t rx_frames)
+{
+	uint32_t threshold = hdd_ctx->config->bus_bw_escalate_threshold;
+
+	if (threshold && rx_frames > threshold)
+		hdd_bus_bw_escalate(hdd_ctx);
+}
+
 static inline enum pld_bus_width_type
 hdd_get_current_throughput_level(struct hdd_context *hdd_ctx)
 {
@@ -3107,6 +3424,15 @@ void hdd_bus_bandwidth_deinit(struct hdd_context *hdd_ctx)
 {
 }
 
+static inline void hdd_bus_bw_escalate(struct hdd_context *hdd_ctx)
+{
+}
+
+static inline void
+hdd_bus_bw_check_rx_backlog(struct hdd_context *hdd_ctx, uint32_t rx_frames)
+{
+}
+
 static inline enum pld_bus_width_type
 hdd_get_current_throughput_level(struct hdd_context *hdd_ctx)
 {
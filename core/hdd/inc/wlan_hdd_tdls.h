@@ -26,6 +26,7 @@
 #include "qca_vendor.h"
 
 struct hdd_context;
+struct wlan_objmgr_vdev;
 
 #ifdef FEATURE_WLAN_TDLS
 
@@ -71,6 +72,34 @@ extern const struct nla_policy
 	vendor_command_policy(VENDOR_CMD_RAW_DATA, 0)                  \
 },
 
+/* Number of peers each CPU can batch per TDLS connection tracker period */
+#define HDD_TDLS_CT_BATCH_SLOTS 8
+
+/**
+ * struct hdd_tdls_ct_slot - batched TDLS tracker counts for one peer
+ * @mac: peer mac address
+ * @tx_cnt: packets sent to @mac since the last flush
+ * @rx_cnt: packets received from @mac since the last flush
+ */
+struct hdd_tdls_ct_slot {
+	struct qdf_mac_addr mac;
+	uint32_t tx_cnt;
+	uint32_t rx_cnt;
+};
+
+/**
+ * struct hdd_tdls_ct_batch - per-CPU TDLS tracker count cache
+ * @slot: small open addressed hash of peers, keyed on the mac address
+ *
+ * Only the owning CPU adds to a batch, so the data path updates it without
+ * atomics or locks. hdd_tdls_ct_flush() folds the counts into the TDLS
+ * connection tracker from the tracker timer; a count racing with the flush
+ * may be lost, which the traffic heuristics tolerate.
+ */
+struct hdd_tdls_ct_batch {
+	struct hdd_tdls_ct_slot slot[HDD_TDLS_CT_BATCH_SLOTS];
+} ____cacheline_aligned_in_smp;
+
 /* Bit mask flag for tdls_option to FW */
 #define ENA_TDLS_OFFCHAN      (1 << 0)  /* TDLS Off Channel support */
 #define ENA_TDLS_BUFFER_STA   (1 << 1)  /* TDLS Buffer STA support */
@@ -206,6 +235,30 @@ int wlan_hdd_cfg80211_configure_tdls_mode(struct wiphy *wiphy,
 QDF_STATUS hdd_tdls_register_peer(void *userdata, uint32_t vdev_id,
 				  const uint8_t *mac, uint8_t qos);
 
+/**
+ * hdd_tdls_ct_count() - batch a tx/rx packet for the TDLS tracker
+ * @adapter: adapter the packet belongs to
+ * @cpu: current CPU index
+ * @mac: peer mac address of the packet
+ * @is_tx: true for a transmitted packet, false for a received one
+ *
+ * Return: None
+ */
+void hdd_tdls_ct_count(struct hdd_adapter *adapter, int cpu,
+		       struct qdf_mac_addr *mac, bool is_tx);
+
+/**
+ * hdd_tdls_ct_flush() - flush the batched counts to the TDLS tracker
+ * @userdata: hdd context
+ * @vdev: vdev of the adapter to flush
+ *
+ * Registered as tdls_ct_flush_callback and run once per TDLS connection
+ * tracker period.
+ *
+ * Return: None
+ */
+void hdd_tdls_ct_flush(void *userdata, struct wlan_objmgr_vdev *vdev);
+
 /**
  * hdd_init_tdls_config() - initialize tdls config
  * @tdls_cfg: pointer to tdls_start_params structure
@@ -250,6 +303,11 @@ QDF_STATUS hdd_tdls_register_peer(void *userdata, uint32_t vdev_id,
 	return QDF_STATUS_SUCCESS;
 }
 
+static inline void hdd_tdls_ct_count(struct hdd_adapter *adapter, int cpu,
+				     struct qdf_mac_addr *mac, bool is_tx)
+{
+}
+
 static inline void hdd_init_tdls_config(struct tdls_start_params *tdls_cfg)
 {
 }
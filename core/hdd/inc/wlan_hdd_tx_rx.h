@@ -182,6 +182,76 @@ static inline QDF_STATUS hdd_rx_fisa_flush_by_vdev_id(void *dp_soc,
 QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
 				   struct sk_buff *skb);
 
+/**
+ * struct hdd_rx_batch - rx frames collected for list delivery to the stack
+ * @list: frames, linked through skb->list
+ * @count: number of frames on @list
+ */
+struct hdd_rx_batch {
+	struct list_head list;
+	uint32_t count;
+};
+
+/**
+ * hdd_rx_batch_init() - initialize an empty rx batch
+ * @batch: batch to initialize
+ *
+ * Return: None
+ */
+static inline void hdd_rx_batch_init(struct hdd_rx_batch *batch)
+{
+	INIT_LIST_HEAD(&batch->list);
+	batch->count = 0;
+}
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(4, 19, 0)) && \
+	!defined(CONFIG_HL_SUPPORT)
+/**
+ * hdd_rx_batch_add() - queue a frame for list delivery
+ * @adapter: pointer to HDD adapter context
+ * @batch: batch to add the frame to
+ * @skb: frame ready for the stack, GRO/LRO ineligible
+ *
+ * Frames received before the peer is registered still need netif_rx_ni(),
+ * so they are refused and must go through hdd_rx_deliver_to_stack().
+ * Queued frames get the same ingress qdisc check and non-offload
+ * accounting as frames delivered by hdd_rx_deliver_to_stack().
+ *
+ * Return: true if @skb was queued, false if the caller must deliver it
+ */
+bool hdd_rx_batch_add(struct hdd_adapter *adapter, struct hdd_rx_batch *batch,
+		      struct sk_buff *skb);
+
+/**
+ * hdd_rx_deliver_to_stack_list() - deliver a batch of rx frames to the stack
+ * @adapter: pointer to HDD adapter context
+ * @batch: frames queued with hdd_rx_batch_add()
+ * @cpu_index: index of the current CPU for the per-CPU stats
+ *
+ * Hands the whole batch to netif_receive_skb_list() and accounts the
+ * delivery stats once for the batch. The batch is empty on return.
+ *
+ * Return: None
+ */
+void hdd_rx_deliver_to_stack_list(struct hdd_adapter *adapter,
+				  struct hdd_rx_batch *batch,
+				  unsigned int cpu_index);
+#else
+static inline
+bool hdd_rx_batch_add(struct hdd_adapter *adapter, struct hdd_rx_batch *batch,
+		      struct sk_buff *skb)
+{
+	return false;
+}
+
+static inline
+void hdd_rx_deliver_to_stack_list(struct hdd_adapter *adapter,
+				  struct hdd_rx_batch *batch,
+				  unsigned int cpu_index)
+{
+}
+#endif
+
 /**
  * hdd_rx_thread_gro_flush_ind_cbk() - receive handler to flush GRO packets
  * @adapter: pointer to HDD adapter
@@ -242,6 +312,16 @@ void hdd_disable_rx_ol_for_low_tput(struct hdd_context *hdd_ctx, bool disable);
  */
 void hdd_reset_all_adapters_connectivity_stats(struct hdd_context *hdd_ctx);
 
+/**
+ * hdd_get_rx_cpu_stats_sum() - Sum the per-CPU rx counters of an adapter
+ * @stats: tx/rx stats of the adapter
+ * @sum: summed rx counters
+ *
+ * Return: None
+ */
+void hdd_get_rx_cpu_stats_sum(struct hdd_tx_rx_stats *stats,
+			      struct hdd_rx_cpu_stats *sum);
+
 /**
  * hdd_tx_rx_collect_connectivity_stats_info() - collect connectivity stats
  * @skb: pointer to skb data
@@ -561,6 +641,18 @@ uint32_t
 wlan_hdd_dump_queue_history_state(struct hdd_netif_queue_history *q_hist,
 				  char *buf, uint32_t size);
 
+/**
+ * wlan_hdd_get_netif_queue_stats() - Get netif queue stats of a reason
+ * @adapter: adapter handle
+ * @reason: reason type
+ * @stats: stats summed over all CPUs, pause time includes an ongoing pause
+ *
+ * Return: None
+ */
+void wlan_hdd_get_netif_queue_stats(struct hdd_adapter *adapter,
+				    enum netif_reason_type reason,
+				    struct hdd_netif_queue_stats *stats);
+
 /**
  * wlan_hdd_rx_rpm_mark_last_busy() - Check if dp rx marked last busy
  * @hdd_ctx: Pointer to hdd context
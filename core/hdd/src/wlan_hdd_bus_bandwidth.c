@@ -176,6 +176,34 @@ bbm_get_bus_bw_level_vote(struct hdd_adapter *adapter,
 	return vote_lvl;
 }
 
+/**
+ * bbm_get_tput_policy_vote() - Get the tput BBM policy vote for a
+ *  throughput level by considering connection modes across adapters
+ * @hdd_ctx: HDD context
+ * @tput_level: throughput level
+ *
+ * Returns: Bus bw level
+ */
+static enum bus_bw_level
+bbm_get_tput_policy_vote(struct hdd_context *hdd_ctx,
+			 enum tput_level tput_level)
+{
+	struct hdd_adapter *adapter;
+	struct hdd_adapter *next_adapter;
+	enum bus_bw_level next_vote = BUS_BW_LEVEL_NONE;
+	enum bus_bw_level tmp_vote;
+
+	hdd_for_each_adapter_dev_held_safe(hdd_ctx, adapter, next_adapter,
+					   NET_DEV_HOLD_BUS_BW_MGR) {
+		tmp_vote = bbm_get_bus_bw_level_vote(adapter, tput_level);
+		if (tmp_vote > next_vote)
+			next_vote = tmp_vote;
+		hdd_adapter_dev_put_debug(adapter, NET_DEV_HOLD_BUS_BW_MGR);
+	}
+
+	return next_vote;
+}
+
 /**
  * bbm_apply_tput_policy() - Apply tput BBM policy by considering
  *  throughput level and connection modes across adapters
@@ -187,10 +215,6 @@ bbm_get_bus_bw_level_vote(struct hdd_adapter *adapter,
 static void
 bbm_apply_tput_policy(struct hdd_context *hdd_ctx, enum tput_level tput_level)
 {
-	struct hdd_adapter *adapter;
-	struct hdd_adapter *next_adapter;
-	enum bus_bw_level next_vote = BUS_BW_LEVEL_NONE;
-	enum bus_bw_level tmp_vote;
 	struct bbm_context *bbm_ctx = hdd_ctx->bbm_ctx;
 
 	if (tput_level == TPUT_LEVEL_NONE) {
@@ -199,19 +223,13 @@ bbm_apply_tput_policy(struct hdd_context *hdd_ctx, enum tput_level tput_level)
 		 * is force cancelled
 		 */
 		if (!hdd_is_any_adapter_connected(hdd_ctx))
-			bbm_ctx->per_policy_vote[BBM_TPUT_POLICY] = next_vote;
+			bbm_ctx->per_policy_vote[BBM_TPUT_POLICY] =
+							BUS_BW_LEVEL_NONE;
 		return;
 	}
 
-	hdd_for_each_adapter_dev_held_safe(hdd_ctx, adapter, next_adapter,
-					   NET_DEV_HOLD_BUS_BW_MGR) {
-		tmp_vote = bbm_get_bus_bw_level_vote(adapter, tput_level);
-		if (tmp_vote > next_vote)
-			next_vote = tmp_vote;
-		hdd_adapter_dev_put_debug(adapter, NET_DEV_HOLD_BUS_BW_MGR);
-	}
-
-	bbm_ctx->per_policy_vote[BBM_TPUT_POLICY] = next_vote;
+	bbm_ctx->per_policy_vote[BBM_TPUT_POLICY] =
+			bbm_get_tput_policy_vote(hdd_ctx, tput_level);
 }
 
 /**
@@ -324,6 +342,26 @@ bbm_apply_user_policy(struct bbm_context *bbm_ctx, bool set,
 	return QDF_STATUS_SUCCESS;
 }
 
+/**
+ * bbm_get_aggregate_vote() - Combine per policy votes into the bus vote
+ * @policy_votes: per policy votes, BBM_MAX_POLICY entries
+ *
+ * Returns: Bus bw level
+ */
+static enum bus_bw_level
+bbm_get_aggregate_vote(const enum bus_bw_level *policy_votes)
+{
+	enum bbm_policy i;
+	enum bus_bw_level next_vote = BUS_BW_LEVEL_NONE;
+
+	for (i = BBM_DRIVER_MODE_POLICY; i < BBM_MAX_POLICY; i++) {
+		if (policy_votes[i] > next_vote)
+			next_vote = policy_votes[i];
+	}
+
+	return next_vote;
+}
+
 /**
  * bbm_request_bus_bandwidth() - Set bus bandwidth level
  * @hdd_ctx: HDD context
@@ -333,15 +371,11 @@ bbm_apply_user_policy(struct bbm_context *bbm_ctx, bool set,
 static void
 bbm_request_bus_bandwidth(struct hdd_context *hdd_ctx)
 {
-	enum bbm_policy i;
-	enum bus_bw_level next_vote = BUS_BW_LEVEL_NONE;
+	enum bus_bw_level next_vote;
 	enum pld_bus_width_type pld_vote;
 	struct bbm_context *bbm_ctx = hdd_ctx->bbm_ctx;
 
-	for (i = BBM_DRIVER_MODE_POLICY; i < BBM_MAX_POLICY; i++) {
-		if (bbm_ctx->per_policy_vote[i] > next_vote)
-			next_vote = bbm_ctx->per_policy_vote[i];
-	}
+	next_vote = bbm_get_aggregate_vote(bbm_ctx->per_policy_vote);
 
 	if (next_vote != bbm_ctx->curr_vote_level) {
 		pld_vote = bbm_convert_to_pld_bus_lvl(next_vote);
@@ -401,6 +435,47 @@ done:
 	qdf_mutex_release(&bbm_ctx->bbm_lock);
 }
 
+enum bus_bw_level
+hdd_bbm_get_votes(struct hdd_context *hdd_ctx, enum bus_bw_level *policy_votes,
+		  enum bus_bw_level *tput_policy_votes)
+{
+	struct bbm_context *bbm_ctx = hdd_ctx->bbm_ctx;
+	enum bus_bw_level curr_vote;
+	enum tput_level level;
+
+	if (!bbm_ctx)
+		return BUS_BW_LEVEL_NONE;
+
+	qdf_mutex_acquire(&bbm_ctx->bbm_lock);
+	qdf_mem_copy(policy_votes, bbm_ctx->per_policy_vote,
+		     sizeof(bbm_ctx->per_policy_vote));
+	curr_vote = bbm_ctx->curr_vote_level;
+
+	tput_policy_votes[TPUT_LEVEL_NONE] = BUS_BW_LEVEL_NONE;
+	for (level = TPUT_LEVEL_IDLE; level < TPUT_LEVEL_MAX; level++)
+		tput_policy_votes[level] = bbm_get_tput_policy_vote(hdd_ctx,
+								    level);
+	qdf_mutex_release(&bbm_ctx->bbm_lock);
+
+	return curr_vote;
+}
+
+enum bus_bw_level
+hdd_bbm_replay_tput_policy(const enum bus_bw_level *policy_votes,
+			   const enum bus_bw_level *tput_policy_votes,
+			   enum tput_level tput_level)
+{
+	enum bus_bw_level votes[BBM_MAX_POLICY];
+
+	if (tput_level >= TPUT_LEVEL_MAX)
+		return BUS_BW_LEVEL_NONE;
+
+	qdf_mem_copy(votes, policy_votes, sizeof(votes));
+	votes[BBM_TPUT_POLICY] = tput_policy_votes[tput_level];
+
+	return bbm_get_aggregate_vote(votes);
+}
+
 int hdd_bbm_context_init(struct hdd_context *hdd_ctx)
 {
 	struct bbm_context *bbm_ctx;
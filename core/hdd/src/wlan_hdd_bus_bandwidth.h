@@ -197,6 +197,38 @@ void hdd_bbm_context_deinit(struct hdd_context *hdd_ctx);
  */
 void hdd_bbm_apply_independent_policy(struct hdd_context *hdd_ctx,
 				      struct bbm_params *params);
+
+/**
+ * hdd_bbm_get_votes() - Get a snapshot of the BBM votes
+ * @hdd_ctx: HDD context
+ * @policy_votes: filled with the per policy votes, BBM_MAX_POLICY entries
+ * @tput_policy_votes: filled with the tput policy vote the current
+ *  connection modes give for each throughput level, TPUT_LEVEL_MAX entries
+ *
+ * Returns: bus bw level currently voted
+ */
+enum bus_bw_level
+hdd_bbm_get_votes(struct hdd_context *hdd_ctx, enum bus_bw_level *policy_votes,
+		  enum bus_bw_level *tput_policy_votes);
+
+/**
+ * hdd_bbm_replay_tput_policy() - Replay the tput BBM policy for a
+ *  throughput level against a snapshot from hdd_bbm_get_votes()
+ * @policy_votes: per policy votes of the snapshot, BBM_MAX_POLICY entries
+ * @tput_policy_votes: tput policy votes per throughput level of the
+ *  snapshot, TPUT_LEVEL_MAX entries
+ * @tput_level: throughput level
+ *
+ * The tput policy vote of @tput_level is combined with the other policy
+ * votes the same way the bus vote is derived, so the result only depends
+ * on the recorded state and not on the current connections.
+ *
+ * Returns: bus bw level that would have been voted
+ */
+enum bus_bw_level
+hdd_bbm_replay_tput_policy(const enum bus_bw_level *policy_votes,
+			   const enum bus_bw_level *tput_policy_votes,
+			   enum tput_level tput_level);
 #else
 static inline int hdd_bbm_context_init(struct hdd_context *hdd_ctx)
 {
@@ -212,5 +244,20 @@ void hdd_bbm_apply_independent_policy(struct hdd_context *hdd_ctx,
 				      struct bbm_params *params)
 {
 }
+
+static inline enum bus_bw_level
+hdd_bbm_get_votes(struct hdd_context *hdd_ctx, enum bus_bw_level *policy_votes,
+		  enum bus_bw_level *tput_policy_votes)
+{
+	return BUS_BW_LEVEL_NONE;
+}
+
+static inline enum bus_bw_level
+hdd_bbm_replay_tput_policy(const enum bus_bw_level *policy_votes,
+			   const enum bus_bw_level *tput_policy_votes,
+			   enum tput_level tput_level)
+{
+	return BUS_BW_LEVEL_NONE;
+}
 #endif
 #endif
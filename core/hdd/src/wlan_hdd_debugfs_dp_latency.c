@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2021 The Linux Foundation. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: wlan_hdd_debugfs_dp_latency.c
+ *
+ * This file currently supports the following debugfs:
+ * Sampled per stage data path latency histograms
+ *
+ * Example to read the histograms:
+ * sm6150:/ # cat /sys/kernel/debug/wlan/dp_latency
+ */
+
+#include <wlan_hdd_includes.h>
+#include <wlan_hdd_debugfs_dp_latency.h>
+#include "osif_sync.h"
+
+#define DP_LATENCY_DEBUGFS_PERMS	(QDF_FILE_USR_READ |	\
+					 QDF_FILE_USR_WRITE |	\
+					 QDF_FILE_GRP_READ |	\
+					 QDF_FILE_OTH_READ)
+
+/* Largest accepted sampling interval */
+#define HDD_DP_LAT_MAX_SAMPLE_RATE (1 << 20)
+
+static const char * const hdd_dp_lat_stage_name[HDD_DP_LAT_STAGE_MAX] = {
+	[HDD_DP_LAT_RX_STACK] = "rx_stack",
+	[HDD_DP_LAT_RX_CHAIN] = "rx_chain",
+	[HDD_DP_LAT_TX_DP] = "tx_dp",
+	[HDD_DP_LAT_TX_COMP] = "tx_comp",
+};
+
+/**
+ * hdd_debugfs_dp_latency_sum() - Sum the histograms of a stage over CPUs
+ * @hdd_ctx: Pointer to the hdd_ctx
+ * @stage: data path stage
+ * @sum: summed histogram
+ *
+ * Return: None
+ */
+static void hdd_debugfs_dp_latency_sum(struct hdd_context *hdd_ctx,
+				       enum hdd_dp_lat_stage stage,
+				       struct hdd_dp_lat_hist *sum)
+{
+	struct hdd_dp_lat_hist *hist;
+	uint32_t cpu, bin;
+
+	qdf_mem_zero(sum, sizeof(*sum));
+	for (cpu = 0; cpu < NUM_CPUS; cpu++) {
+		hist = &hdd_ctx->dp_lat[cpu].hist[stage];
+		sum->count += hist->count;
+		sum->sum_us += hist->sum_us;
+		sum->max_us = qdf_max(sum->max_us, hist->max_us);
+		for (bin = 0; bin < HDD_DP_LAT_NUM_BINS; bin++)
+			sum->bin[bin] += hist->bin[bin];
+	}
+}
+
+static int __hdd_debugfs_dp_latency_read(struct hdd_context *hdd_ctx,
+					 qdf_debugfs_file_t file)
+{
+	struct hdd_dp_lat_hist sum;
+	enum hdd_dp_lat_stage stage;
+	uint32_t bin;
+	int ret;
+
+	ret = wlan_hdd_validate_context(hdd_ctx);
+	if (ret)
+		return ret;
+
+	qdf_debugfs_printf(file, "sample_rate %u\n",
+			   hdd_ctx->dp_lat_sample_rate);
+	qdf_debugfs_printf(file, "stage count avg_us max_us");
+	for (bin = 0; bin < HDD_DP_LAT_NUM_BINS; bin++)
+		qdf_debugfs_printf(file, " %s%u", bin ? ">=" : "<",
+				   bin ? 1 << (bin - 1) : 1);
+	qdf_debugfs_printf(file, "\n");
+
+	for (stage = 0; stage < HDD_DP_LAT_STAGE_MAX; stage++) {
+		hdd_debugfs_dp_latency_sum(hdd_ctx, stage, &sum);
+		qdf_debugfs_printf(file, "%s %u %llu %u",
+				   hdd_dp_lat_stage_name[stage], sum.count,
+				   sum.count ? qdf_do_div(sum.sum_us,
+							  sum.count) : 0,
+				   sum.max_us);
+		for (bin = 0; bin < HDD_DP_LAT_NUM_BINS; bin++)
+			qdf_debugfs_printf(file, " %u", sum.bin[bin]);
+		qdf_debugfs_printf(file, "\n");
+	}
+
+	return 0;
+}
+
+/**
+ * hdd_debugfs_dp_latency_read() - SSR wrapper function to read the
+ * data path latency histograms
+ * @file: file pointer
+ * @arg: hdd_ctx
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS hdd_debugfs_dp_latency_read(qdf_debugfs_file_t file,
+					      void *arg)
+{
+	struct osif_psoc_sync *psoc_sync;
+	struct hdd_context *hdd_ctx = arg;
+	int ret;
+
+	ret = osif_psoc_sync_op_start(wiphy_dev(hdd_ctx->wiphy), &psoc_sync);
+	if (ret)
+		return qdf_status_from_os_return(ret);
+
+	ret = __hdd_debugfs_dp_latency_read(hdd_ctx, file);
+
+	osif_psoc_sync_op_stop(psoc_sync);
+	return qdf_status_from_os_return(ret);
+}
+
+static int __hdd_debugfs_dp_latency_write(struct hdd_context *hdd_ctx,
+					  const char *buf)
+{
+	uint32_t cpu, rate;
+	int ret;
+
+	ret = wlan_hdd_validate_context(hdd_ctx);
+	if (ret)
+		return ret;
+
+	if (!strncmp(buf, "reset", 5)) {
+		for (cpu = 0; cpu < NUM_CPUS; cpu++)
+			qdf_mem_zero(hdd_ctx->dp_lat[cpu].hist,
+				     sizeof(hdd_ctx->dp_lat[cpu].hist));
+		return 0;
+	}
+
+	if (kstrtou32(buf, 0, &rate) ||
+	    rate > HDD_DP_LAT_MAX_SAMPLE_RATE) {
+		hdd_err_rl("dp_latency: invalid sample rate");
+		return -EINVAL;
+	}
+
+	if (rate)
+		rate = roundup_pow_of_two(rate);
+
+	hdd_debug("dp_latency: sample 1 in %u", rate);
+	hdd_ctx->dp_lat_sample_rate = rate;
+
+	return 0;
+}
+
+/**
+ * hdd_debugfs_dp_latency_write() - SSR wrapper function to set the
+ * sampling rate or clear the data path latency histograms
+ * @priv: hdd_ctx
+ * @buf: user command
+ * @len: length of @buf
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS hdd_debugfs_dp_latency_write(void *priv, const char *buf,
+					       qdf_size_t len)
+{
+	struct osif_psoc_sync *psoc_sync;
+	struct hdd_context *hdd_ctx = priv;
+	int ret;
+
+	ret = osif_psoc_sync_op_start(wiphy_dev(hdd_ctx->wiphy), &psoc_sync);
+	if (ret)
+		return qdf_status_from_os_return(ret);
+
+	ret = __hdd_debugfs_dp_latency_write(hdd_ctx, buf);
+
+	osif_psoc_sync_op_stop(psoc_sync);
+	return qdf_status_from_os_return(ret);
+}
+
+static struct qdf_debugfs_fops hdd_dp_latency_debugfs_fops = {
+	.show  = hdd_debugfs_dp_latency_read,
+	.write = hdd_debugfs_dp_latency_write,
+};
+
+void hdd_debugfs_dp_latency_init(struct hdd_context *hdd_ctx)
+{
+	hdd_dp_latency_debugfs_fops.priv = hdd_ctx;
+
+	if (!qdf_debugfs_create_file("dp_latency", DP_LATENCY_DEBUGFS_PERMS,
+				     NULL, &hdd_dp_latency_debugfs_fops))
+		hdd_err("Failed to create the dp latency file");
+}
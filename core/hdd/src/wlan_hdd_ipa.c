@@ -437,6 +437,7 @@ void hdd_ipa_send_nbuf_to_network(qdf_nbuf_t nbuf, qdf_netdev_t dev)
 	struct hdd_adapter *adapter = (struct hdd_adapter *) netdev_priv(dev);
 	int result;
 	unsigned int cpu_index;
+	struct hdd_rx_cpu_stats *rx_stats;
 	uint32_t enabled;
 
 	if (hdd_validate_adapter(adapter)) {
@@ -484,8 +485,9 @@ void hdd_ipa_send_nbuf_to_network(qdf_nbuf_t nbuf, qdf_netdev_t dev)
 	nbuf->ip_summed = CHECKSUM_NONE;
 
 	cpu_index = wlan_hdd_get_cpu();
+	rx_stats = &adapter->hdd_stats.tx_rx_stats.rx_cpu[cpu_index];
 
-	++adapter->hdd_stats.tx_rx_stats.rx_packets[cpu_index];
+	++rx_stats->rx_packets;
 
 	/*
 	 * Update STA RX exception packet stats.
@@ -497,9 +499,9 @@ void hdd_ipa_send_nbuf_to_network(qdf_nbuf_t nbuf, qdf_netdev_t dev)
 
 	result = hdd_ipa_aggregated_rx_ind(nbuf);
 	if (result == NET_RX_SUCCESS)
-		++adapter->hdd_stats.tx_rx_stats.rx_delivered[cpu_index];
+		++rx_stats->rx_delivered;
 	else
-		++adapter->hdd_stats.tx_rx_stats.rx_refused[cpu_index];
+		++rx_stats->rx_refused;
 
 	/*
 	 * Restore PF_WAKE_UP_IDLE flag in the task structure
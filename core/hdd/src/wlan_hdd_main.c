@@ -176,6 +176,7 @@
 #include <wlan_interop_issues_ap_ucfg_api.h>
 #include <target_type.h>
 #include <wlan_hdd_debugfs_coex.h>
+#include <wlan_hdd_debugfs_dp_latency.h>
 #include <wlan_hdd_debugfs_config.h>
 #include "wlan_blm_ucfg_api.h"
 #include "ftm_time_sync_ucfg_api.h"
@@ -743,6 +744,7 @@ void wlan_hdd_send_tcp_param_update_event(struct hdd_context *hdd_ctx,
 	bool tcp_del_ack_ind_enabled = false;
 	bool tcp_adv_win_scl_enabled = false;
 	enum wlan_tp_level next_tp_level = WLAN_SVC_TP_NONE;
+	uint32_t delack_seg = 0, win_scale = 0;
 
 	event_len = sizeof(uint8_t) + sizeof(uint8_t) + NLMSG_HDRLEN;
 
@@ -771,6 +773,19 @@ void wlan_hdd_send_tcp_param_update_event(struct hdd_context *hdd_ctx,
 			event_len += sizeof(uint32_t); /* TCP_ADV_WIN_SCALE */
 			tcp_adv_win_scl_enabled = true;
 		}
+
+		delack_seg = (next_tp_level == WLAN_SVC_TP_LOW ?
+			      TCP_DEL_ACK_LOW : TCP_DEL_ACK_HI);
+		win_scale = (next_tp_level == WLAN_SVC_TP_LOW ?
+			     WIN_SCALE_LOW : WIN_SCALE_HI);
+
+		/* adaptive values take precedence over the fixed ones */
+		qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+		if (hdd_ctx->tcp_rx_tune.delack_seg)
+			delack_seg = hdd_ctx->tcp_rx_tune.delack_seg;
+		if (hdd_ctx->tcp_rx_tune.win_scale)
+			win_scale = hdd_ctx->tcp_rx_tune.win_scale;
+		qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
 	} else {
 		hdd_err("Invalid Direction [%d]", dir);
 		return;
@@ -815,16 +830,14 @@ void wlan_hdd_send_tcp_param_update_event(struct hdd_context *hdd_ctx,
 	    (nla_put_u32(
 		vendor_event,
 		QCA_WLAN_VENDOR_ATTR_THROUGHPUT_CHANGE_TCP_DELACK_SEG,
-		(next_tp_level == WLAN_SVC_TP_LOW ?
-		 TCP_DEL_ACK_LOW : TCP_DEL_ACK_HI))))
+		delack_seg)))
 		goto tcp_param_change_nla_failed;
 
 	if (tcp_adv_win_scl_enabled &&
 	    (nla_put_u32(
 		vendor_event,
 		QCA_WLAN_VENDOR_ATTR_THROUGHPUT_CHANGE_TCP_ADV_WIN_SCALE,
-		(next_tp_level == WLAN_SVC_TP_LOW ?
-		 WIN_SCALE_LOW : WIN_SCALE_HI))))
+		win_scale)))
 		goto tcp_param_change_nla_failed;
 
 	cfg80211_vendor_event(vendor_event, GFP_KERNEL);
@@ -1623,6 +1636,8 @@ static int hdd_update_tdls_config(struct hdd_context *hdd_ctx)
 	tdls_cfg.tdls_dp_vdev_update = hdd_update_dp_vdev_flags;
 	tdls_cfg.tdls_osif_init_cb = wlan_cfg80211_tdls_osif_priv_init;
 	tdls_cfg.tdls_osif_deinit_cb = wlan_cfg80211_tdls_osif_priv_deinit;
+	tdls_cfg.tdls_ct_flush_cb = hdd_tdls_ct_flush;
+	tdls_cfg.tdls_ct_cb_data = hdd_ctx;
 
 	status = ucfg_tdls_update_config(psoc, &tdls_cfg);
 	if (status != QDF_STATUS_SUCCESS) {
@@ -10179,6 +10194,368 @@ static inline void hdd_low_tput_gro_flush_skip_handler(
 	}
 }
 
+/* EWMA weight of the predictive bus bw controller, 1/2^shift */
+#define HDD_BUS_BW_EWMA_SHIFT 2
+
+enum tput_level
+hdd_bus_bw_thres_to_tput_level(const struct hdd_bus_bw_thresholds *thres,
+			       uint64_t pkts)
+{
+	if (pkts > thres->very_high)
+		return TPUT_LEVEL_VERY_HIGH;
+	if (pkts > thres->high)
+		return TPUT_LEVEL_HIGH;
+	if (pkts > thres->medium)
+		return TPUT_LEVEL_MEDIUM;
+	if (pkts > thres->low)
+		return TPUT_LEVEL_LOW;
+
+	return TPUT_LEVEL_IDLE;
+}
+
+/**
+ * hdd_bus_bw_pkts_to_tput_level() - Map an interval packet count to a
+ *  throughput level using the configured bus bandwidth thresholds
+ * @hdd_ctx: HDD context
+ * @pkts: tx + rx packets in one bus bandwidth compute interval
+ *
+ * Return: throughput level
+ */
+static enum tput_level
+hdd_bus_bw_pkts_to_tput_level(struct hdd_context *hdd_ctx, uint64_t pkts)
+{
+	struct hdd_bus_bw_thresholds thres = {
+		.very_high = hdd_ctx->config->bus_bw_very_high_threshold,
+		.high = hdd_ctx->config->bus_bw_high_threshold,
+		.medium = hdd_ctx->config->bus_bw_medium_threshold,
+		.low = hdd_ctx->config->bus_bw_low_threshold,
+	};
+
+	return hdd_bus_bw_thres_to_tput_level(&thres, pkts);
+}
+
+/**
+ * hdd_tput_level_to_bus_width() - Map a throughput level to pld bus width
+ * @tput_level: throughput level
+ *
+ * Return: pld bus width type
+ */
+static enum pld_bus_width_type
+hdd_tput_level_to_bus_width(enum tput_level tput_level)
+{
+	switch (tput_level) {
+	case TPUT_LEVEL_VERY_HIGH:
+		return PLD_BUS_WIDTH_VERY_HIGH;
+	case TPUT_LEVEL_HIGH:
+		return PLD_BUS_WIDTH_HIGH;
+	case TPUT_LEVEL_MEDIUM:
+		return PLD_BUS_WIDTH_MEDIUM;
+	case TPUT_LEVEL_LOW:
+		return PLD_BUS_WIDTH_LOW;
+	default:
+		return PLD_BUS_WIDTH_IDLE;
+	}
+}
+
+/**
+ * hdd_bus_bw_predict_tput_level() - Predictive throughput level controller
+ * @hdd_ctx: HDD context
+ * @total_pkts: tx + rx packets in the last bus bandwidth compute interval
+ *
+ * The level is raised immediately when the packet count projected one
+ * interval ahead (current count plus its positive trend) crosses a higher
+ * threshold. It is lowered only once the EWMA of the packet count, and the
+ * current count, have stayed below the current level for
+ * bus_bw_down_hysteresis consecutive intervals.
+ *
+ * Return: throughput level to vote
+ */
+static enum tput_level
+hdd_bus_bw_predict_tput_level(struct hdd_context *hdd_ctx,
+			      uint64_t total_pkts)
+{
+	uint64_t projected = total_pkts;
+	enum tput_level up_level, down_level, level;
+
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+
+	if (total_pkts > hdd_ctx->bus_bw_prev_total)
+		projected += total_pkts - hdd_ctx->bus_bw_prev_total;
+	hdd_ctx->bus_bw_prev_total = total_pkts;
+
+	hdd_ctx->bus_bw_ewma = hdd_ctx->bus_bw_ewma -
+			       (hdd_ctx->bus_bw_ewma >> HDD_BUS_BW_EWMA_SHIFT) +
+			       (total_pkts >> HDD_BUS_BW_EWMA_SHIFT);
+
+	level = hdd_ctx->bus_bw_pred_level;
+	up_level = hdd_bus_bw_pkts_to_tput_level(hdd_ctx, projected);
+	down_level = hdd_bus_bw_pkts_to_tput_level(hdd_ctx,
+					QDF_MAX(hdd_ctx->bus_bw_ewma,
+						total_pkts));
+
+	if (up_level > level) {
+		level = up_level;
+		hdd_ctx->bus_bw_down_cnt = 0;
+	} else if (down_level < level) {
+		if (++hdd_ctx->bus_bw_down_cnt >=
+		    hdd_ctx->config->bus_bw_down_hysteresis) {
+			level = down_level;
+			hdd_ctx->bus_bw_down_cnt = 0;
+		}
+	} else {
+		hdd_ctx->bus_bw_down_cnt = 0;
+	}
+
+	hdd_ctx->bus_bw_pred_level = level;
+
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+
+	return level;
+}
+
+/**
+ * hdd_bus_bw_predict_reset() - Reset the predictive controller state
+ * @hdd_ctx: HDD context
+ *
+ * Return: None
+ */
+static void hdd_bus_bw_predict_reset(struct hdd_context *hdd_ctx)
+{
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	hdd_ctx->bus_bw_ewma = 0;
+	hdd_ctx->bus_bw_prev_total = 0;
+	hdd_ctx->bus_bw_down_cnt = 0;
+	hdd_ctx->bus_bw_pred_level = TPUT_LEVEL_IDLE;
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+}
+
+void hdd_bus_bw_escalate(struct hdd_context *hdd_ctx)
+{
+	if (!hdd_ctx->config->bus_bw_predictive_vote)
+		return;
+
+	if (!qdf_atomic_read(&hdd_ctx->bus_bw_escalate_active))
+		return;
+
+	if (hdd_ctx->bus_bw_pred_level >= TPUT_LEVEL_VERY_HIGH)
+		return;
+
+	if (qdf_atomic_inc_return(&hdd_ctx->bus_bw_escalate_pending) > 1)
+		return;
+
+	qdf_sched_work(0, &hdd_ctx->bus_bw_escalate_work);
+}
+
+/**
+ * hdd_bus_bw_escalate_work_handler() - Raise the bus vote by one level
+ * @context: HDD context
+ *
+ * Runs in process context on behalf of hdd_bus_bw_escalate(). The raised
+ * level is recorded in the predictive controller so that the next compute
+ * interval holds it through the down hysteresis instead of dropping it.
+ *
+ * Return: None
+ */
+static void hdd_bus_bw_escalate_work_handler(void *context)
+{
+	struct hdd_context *hdd_ctx = context;
+	struct bbm_params param = {0};
+	enum tput_level level;
+
+	/*
+	 * The bus bw timer stopped after this work was queued, its stop path
+	 * flushes this work before it removes the tput vote.
+	 */
+	if (!qdf_atomic_read(&hdd_ctx->bus_bw_escalate_active)) {
+		qdf_atomic_set(&hdd_ctx->bus_bw_escalate_pending, 0);
+		return;
+	}
+
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	level = hdd_ctx->bus_bw_pred_level;
+	if (level < TPUT_LEVEL_VERY_HIGH) {
+		level = level < TPUT_LEVEL_IDLE ? TPUT_LEVEL_LOW : level + 1;
+		hdd_ctx->bus_bw_pred_level = level;
+		hdd_ctx->bus_bw_down_cnt = 0;
+	}
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+
+	/* allow the data path to trigger the next escalation */
+	qdf_atomic_set(&hdd_ctx->bus_bw_escalate_pending, 0);
+
+	hdd_debug("escalate tput level to %d", level);
+	param.policy = BBM_TPUT_POLICY;
+	param.policy_info.tput_level = level;
+	hdd_bbm_apply_independent_policy(hdd_ctx, &param);
+}
+
+#ifdef WLAN_SYSFS_BUS_BW_TRACE
+/**
+ * hdd_bus_bw_trace_record() - Record one bus bw compute interval
+ * @hdd_ctx: HDD context
+ * @tx_packets: tx packets in the interval
+ * @rx_packets: rx packets in the interval
+ * @no_tx_offload_pkts: tx packets in the interval not using TSO
+ * @no_rx_offload_pkts: rx packets in the interval not using LRO/GRO
+ * @tput_level: throughput level selected for the interval
+ * @vote_level: pld_bus_width_type selected for the interval
+ *
+ * Return: None
+ */
+static void hdd_bus_bw_trace_record(struct hdd_context *hdd_ctx,
+				    uint64_t tx_packets, uint64_t rx_packets,
+				    uint64_t no_tx_offload_pkts,
+				    uint64_t no_rx_offload_pkts,
+				    enum tput_level tput_level,
+				    enum pld_bus_width_type vote_level)
+{
+	struct hdd_bus_bw_trace *trace = &hdd_ctx->bus_bw_trace;
+	struct hdd_bus_bw_trace_rec *rec;
+	enum bus_bw_level votes[BBM_MAX_POLICY] = {0};
+	enum bus_bw_level tput_votes[TPUT_LEVEL_MAX] = {0};
+	enum bus_bw_level bbm_vote;
+	enum tput_level level;
+	enum bbm_policy i;
+
+	bbm_vote = hdd_bbm_get_votes(hdd_ctx, votes, tput_votes);
+
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	rec = &trace->rec[trace->idx];
+	rec->qtime = qdf_get_log_timestamp();
+	rec->tx_packets = tx_packets;
+	rec->rx_packets = rx_packets;
+	rec->no_tx_offload_pkts = no_tx_offload_pkts;
+	rec->no_rx_offload_pkts = no_rx_offload_pkts;
+	rec->tput_level = tput_level;
+	rec->vote_level = vote_level;
+	rec->rx_level = hdd_ctx->cur_rx_level;
+	rec->tx_level = hdd_ctx->cur_tx_level;
+	rec->bbm_vote = bbm_vote;
+	for (i = 0; i < BBM_MAX_POLICY; i++)
+		rec->policy_vote[i] = votes[i];
+	for (level = TPUT_LEVEL_NONE; level < TPUT_LEVEL_MAX; level++)
+		rec->tput_policy_vote[level] = tput_votes[level];
+
+	trace->idx = (trace->idx + 1) % HDD_BUS_BW_TRACE_SIZE;
+	if (trace->count < HDD_BUS_BW_TRACE_SIZE)
+		trace->count++;
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+}
+#else
+static inline void hdd_bus_bw_trace_record(struct hdd_context *hdd_ctx,
+					   uint64_t tx_packets,
+					   uint64_t rx_packets,
+					   uint64_t no_tx_offload_pkts,
+					   uint64_t no_rx_offload_pkts,
+					   enum tput_level tput_level,
+					   enum pld_bus_width_type vote_level)
+{
+}
+#endif
+
+/* Acks per RTT the delayed ack count has to leave to clock the sender */
+#define HDD_TCP_RX_TUNE_ACKS_PER_RTT 8
+/* RTT assumed until the first sample of a local TCP flow is taken */
+#define HDD_TCP_RX_TUNE_DEFAULT_RTT_US 20000
+/*
+ * BDP from which the larger window of WIN_SCALE_HI is advertised. The
+ * stack takes an integer adv win scale, so only the two fixed values exist.
+ */
+#define HDD_TCP_RX_TUNE_WIN_SCALE_BDP (2 * 1024 * 1024)
+/* Segment size assumed to turn the rx packet rate into a byte rate */
+#define HDD_TCP_RX_TUNE_MSS 1460
+
+/**
+ * hdd_tcp_rx_tune_update() - Derive the TCP rx parameters of an interval
+ * @hdd_ctx: HDD context
+ * @avg_rx: average rx packets per bus bw compute interval
+ *
+ * The delayed ack segment count is sized so that the segments received
+ * within one RTT still produce HDD_TCP_RX_TUNE_ACKS_PER_RTT acks, within
+ * the fixed low and high values of the two state scheme. The adv window
+ * scale still takes one of the two fixed values, but is selected by the
+ * bandwidth delay product at the link PHY rate, which bounds the window
+ * the receiver may have to advertise, instead of by the rx level.
+ *
+ * Return: true if a parameter changed and has to be indicated
+ */
+static bool hdd_tcp_rx_tune_update(struct hdd_context *hdd_ctx,
+				   uint64_t avg_rx)
+{
+	struct hdd_tcp_rx_tune *tune = &hdd_ctx->tcp_rx_tune;
+	uint32_t interval = hdd_ctx->config->bus_bw_compute_interval;
+	uint32_t delack_lo, delack_hi, delack_seg, win_scale, step;
+	uint64_t srtt_us, rx_pps, pkts_per_rtt, bdp, rx_bdp;
+	bool changed;
+
+	if (!hdd_ctx->config->tcp_rx_adaptive_tuning ||
+	    !hdd_ctx->config->enable_tcp_param_update || !interval)
+		return false;
+
+	srtt_us = tune->srtt_us >> 3;
+	if (!srtt_us)
+		srtt_us = HDD_TCP_RX_TUNE_DEFAULT_RTT_US;
+
+	rx_pps = qdf_do_div(avg_rx * 1000, interval);
+	pkts_per_rtt = qdf_do_div(rx_pps * srtt_us, 1000000);
+
+	delack_lo = qdf_max_t(uint32_t, qdf_min(TCP_DEL_ACK_LOW,
+						TCP_DEL_ACK_HI), 1);
+	delack_hi = qdf_max_t(uint32_t, qdf_max(TCP_DEL_ACK_LOW,
+						TCP_DEL_ACK_HI), delack_lo);
+	delack_seg = qdf_min_t(uint64_t, qdf_do_div(pkts_per_rtt,
+				HDD_TCP_RX_TUNE_ACKS_PER_RTT), delack_hi);
+	delack_seg = qdf_max(delack_seg, delack_lo);
+
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	/* Mbps times usecs gives bits, the larger of PHY and rx rate rules */
+	bdp = qdf_do_div((uint64_t)tune->phy_rate * srtt_us, 8);
+	rx_bdp = pkts_per_rtt * HDD_TCP_RX_TUNE_MSS;
+	bdp = qdf_max(bdp, rx_bdp);
+	win_scale = bdp >= HDD_TCP_RX_TUNE_WIN_SCALE_BDP ?
+		    WIN_SCALE_HI : WIN_SCALE_LOW;
+
+	tune->rx_pps = rx_pps;
+	tune->pkts_per_rtt = pkts_per_rtt;
+
+	/* ignore delack moves within a quarter of the current count */
+	step = qdf_max_t(uint32_t, tune->delack_seg / 4, 1);
+	if (tune->delack_seg &&
+	    qdf_max(delack_seg, tune->delack_seg) -
+	    qdf_min(delack_seg, tune->delack_seg) < step)
+		delack_seg = tune->delack_seg;
+
+	changed = delack_seg != tune->delack_seg ||
+		  win_scale != tune->win_scale;
+	if (changed) {
+		tune->delack_seg = delack_seg;
+		tune->win_scale = win_scale;
+		tune->updates++;
+		tune->qtime = qdf_get_log_timestamp();
+	}
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+
+	if (changed)
+		hdd_debug("tcp rx tune: pps %llu srtt %llu phy %u delack %u win scale %u",
+			  rx_pps, srtt_us, tune->phy_rate, delack_seg,
+			  win_scale);
+
+	return changed;
+}
+
+/**
+ * hdd_tcp_rx_tune_reset() - Reset the adaptive TCP rx parameter controller
+ * @hdd_ctx: HDD context
+ *
+ * Return: None
+ */
+static void hdd_tcp_rx_tune_reset(struct hdd_context *hdd_ctx)
+{
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	qdf_mem_zero(&hdd_ctx->tcp_rx_tune, sizeof(hdd_ctx->tcp_rx_tune));
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+}
+
 /**
  * hdd_pld_request_bus_bandwidth() - Function to control bus bandwidth
  * @hdd_ctx - handle to hdd context
@@ -10198,6 +10575,7 @@ static void hdd_pld_request_bus_bandwidth(struct hdd_context *hdd_ctx,
 	uint16_t index = 0;
 	bool vote_level_change = false;
 	bool rx_level_change = false;
+	bool rx_tune_change;
 	bool tx_level_change = false;
 	bool rxthread_high_tput_req = false;
 	bool dptrace_high_tput_req;
@@ -10222,21 +10600,14 @@ static void hdd_pld_request_bus_bandwidth(struct hdd_context *hdd_ctx,
 	if (hdd_ctx->high_bus_bw_request) {
 		next_vote_level = PLD_BUS_WIDTH_VERY_HIGH;
 		tput_level = TPUT_LEVEL_VERY_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_very_high_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_VERY_HIGH;
-		tput_level = TPUT_LEVEL_VERY_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_high_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_HIGH;
-		tput_level = TPUT_LEVEL_HIGH;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_medium_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_MEDIUM;
-		tput_level = TPUT_LEVEL_MEDIUM;
-	} else if (total_pkts > hdd_ctx->config->bus_bw_low_threshold) {
-		next_vote_level = PLD_BUS_WIDTH_LOW;
-		tput_level = TPUT_LEVEL_LOW;
+	} else if (hdd_ctx->config->bus_bw_predictive_vote) {
+		tput_level = hdd_bus_bw_predict_tput_level(hdd_ctx,
+							   total_pkts);
+		next_vote_level = hdd_tput_level_to_bus_width(tput_level);
 	} else {
-		next_vote_level = PLD_BUS_WIDTH_IDLE;
-		tput_level = TPUT_LEVEL_IDLE;
+		tput_level = hdd_bus_bw_pkts_to_tput_level(hdd_ctx,
+							   total_pkts);
+		next_vote_level = hdd_tput_level_to_bus_width(tput_level);
 	}
 
 	param.policy = BBM_TPUT_POLICY;
@@ -10355,7 +10726,9 @@ static void hdd_pld_request_bus_bandwidth(struct hdd_context *hdd_ctx,
 		next_rx_level = WLAN_SVC_TP_LOW;
 	}
 
-	if (hdd_ctx->cur_rx_level != next_rx_level) {
+	rx_tune_change = hdd_tcp_rx_tune_update(hdd_ctx, avg_rx);
+
+	if (hdd_ctx->cur_rx_level != next_rx_level || rx_tune_change) {
 		struct wlan_rx_tp_data rx_tp_data = {0};
 
 		hdd_ctx->cur_rx_level = next_rx_level;
@@ -10415,6 +10788,10 @@ static void hdd_pld_request_bus_bandwidth(struct hdd_context *hdd_ctx,
 		wlan_hdd_update_tcp_tx_param(hdd_ctx, &tx_tp_data);
 	}
 
+	hdd_bus_bw_trace_record(hdd_ctx, tx_packets, rx_packets,
+				no_tx_offload_pkts, no_rx_offload_pkts,
+				tput_level, next_vote_level);
+
 	index = hdd_ctx->hdd_txrx_hist_idx;
 	if (vote_level_change || tx_level_change || rx_level_change) {
 		/* Clear all the mask if no silver/gold vote is required */
@@ -10582,6 +10959,7 @@ static void __hdd_bus_bw_work_handler(struct hdd_context *hdd_ctx)
 	bool connected = false;
 	uint32_t ipa_tx_packets = 0, ipa_rx_packets = 0;
 	uint64_t sta_tx_bytes = 0, sap_tx_bytes = 0;
+	uint32_t link_rx_rate = 0;
 	wlan_net_dev_ref_dbgid dbgid = NET_DEV_HOLD_BUS_BW_WORK_HANDLER;
 
 	if (wlan_hdd_validate_context(hdd_ctx))
@@ -10652,6 +11030,11 @@ static void __hdd_bus_bw_work_handler(struct hdd_context *hdd_ctx)
 		if (adapter->device_mode == QDF_STA_MODE)
 			sta_tx_bytes = adapter->stats.tx_bytes;
 
+		if (adapter->device_mode == QDF_STA_MODE ||
+		    adapter->device_mode == QDF_P2P_CLIENT_MODE)
+			link_rx_rate = qdf_max_t(uint32_t, link_rx_rate,
+				adapter->hdd_stats.class_a_stat.rx_rate);
+
 		hdd_set_driver_del_ack_enable(adapter->vdev_id, hdd_ctx,
 					      rx_packets);
 
@@ -10677,6 +11060,11 @@ static void __hdd_bus_bw_work_handler(struct hdd_context *hdd_ctx)
 		goto stop_work;
 	}
 
+	/* link rx rate is reported in units of 100 kbps */
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	hdd_ctx->tcp_rx_tune.phy_rate = link_rx_rate / 10;
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+
 	/* add intra bss forwarded tx and rx packets */
 	tx_packets += fwd_tx_packets_diff;
 	rx_packets += fwd_rx_packets_diff;
@@ -10725,6 +11113,18 @@ int hdd_bus_bandwidth_init(struct hdd_context *hdd_ctx)
 	status = qdf_periodic_work_create(&hdd_ctx->bus_bw_work,
 					  hdd_bus_bw_work_handler,
 					  hdd_ctx);
+	if (QDF_IS_STATUS_SUCCESS(status)) {
+		qdf_atomic_init(&hdd_ctx->bus_bw_escalate_pending);
+		qdf_atomic_init(&hdd_ctx->bus_bw_escalate_active);
+		/* without the work the predictor still runs, unescalated */
+		if (QDF_IS_STATUS_SUCCESS(
+			qdf_create_work(0, &hdd_ctx->bus_bw_escalate_work,
+					hdd_bus_bw_escalate_work_handler,
+					hdd_ctx)))
+			hdd_ctx->bus_bw_escalate_work_init = true;
+		else
+			hdd_err("Failed to create bus bw escalate work");
+	}
 
 	hdd_exit();
 
@@ -10740,6 +11140,12 @@ void hdd_bus_bandwidth_deinit(struct hdd_context *hdd_ctx)
 	 */
 	QDF_BUG(!qdf_periodic_work_stop_sync(&hdd_ctx->bus_bw_work));
 
+	if (hdd_ctx->bus_bw_escalate_work_init) {
+		qdf_atomic_set(&hdd_ctx->bus_bw_escalate_active, 0);
+		qdf_flush_work(&hdd_ctx->bus_bw_escalate_work);
+		qdf_destroy_work(0, &hdd_ctx->bus_bw_escalate_work);
+		hdd_ctx->bus_bw_escalate_work_init = false;
+	}
 	qdf_periodic_work_destroy(&hdd_ctx->bus_bw_work);
 	qdf_spinlock_destroy(&hdd_ctx->bus_bw_lock);
 	hdd_pm_qos_remove_request(hdd_ctx);
@@ -11080,6 +11486,7 @@ hdd_display_netif_queue_history_compact(struct hdd_context *hdd_ctx)
 	char temp_str[20 * WLAN_REASON_TYPE_MAX];
 	char *comb_log_str;
 	uint32_t comb_log_str_size;
+	struct hdd_netif_queue_stats q_stats;
 	struct hdd_adapter *adapter = NULL, *next_adapter = NULL;
 	wlan_net_dev_ref_dbgid dbgid =
 			NET_DEV_HOLD_DISPLAY_NETIF_QUEUE_HISTORY_COMPACT;
@@ -11108,7 +11515,8 @@ hdd_display_netif_queue_history_compact(struct hdd_context *hdd_ctx)
 		tbytes = 0;
 		qdf_mem_zero(temp_str, sizeof(temp_str));
 		for (i = WLAN_CONTROL_PATH; i < WLAN_REASON_TYPE_MAX; i++) {
-			if (adapter->queue_oper_stats[i].pause_count == 0)
+			wlan_hdd_get_netif_queue_stats(adapter, i, &q_stats);
+			if (q_stats.pause_count == 0)
 				continue;
 			tbytes +=
 				snprintf(
@@ -11117,10 +11525,8 @@ hdd_display_netif_queue_history_compact(struct hdd_context *hdd_ctx)
 					0 : sizeof(temp_str) - tbytes),
 					"%d(%d,%d) ",
 					i,
-					adapter->queue_oper_stats[i].
-								pause_count,
-					adapter->queue_oper_stats[i].
-								unpause_count);
+					q_stats.pause_count,
+					q_stats.unpause_count);
 		}
 		if (tbytes >= sizeof(temp_str))
 			hdd_warn("log truncated");
@@ -11162,8 +11568,11 @@ hdd_display_netif_queue_history_compact(struct hdd_context *hdd_ctx)
 static void
 wlan_hdd_display_adapter_netif_queue_stats(struct hdd_adapter *adapter)
 {
-	int i;
+	int i, cpu;
+	uint32_t index;
 	qdf_time_t total, pause, unpause, curr_time, delta;
+	struct hdd_netif_queue_stats q_stats;
+	struct hdd_netif_queue_cpu_history *cpu_hist;
 	struct hdd_netif_queue_history *q_hist_ptr;
 	char q_status_buf[NUM_TX_QUEUES * HDD_NETDEV_TX_Q_STATE_STRLEN] = {0};
 
@@ -11188,50 +11597,50 @@ wlan_hdd_display_adapter_netif_queue_stats(struct hdd_adapter *adapter)
 	hdd_nofl_debug("reason_type: pause_cnt: unpause_cnt: pause_time");
 
 	for (i = WLAN_CONTROL_PATH; i < WLAN_REASON_TYPE_MAX; i++) {
-		qdf_time_t pause_delta = 0;
-
-		if (adapter->pause_map & (1 << i))
-			pause_delta = delta;
+		wlan_hdd_get_netif_queue_stats(adapter, i, &q_stats);
 
 		/* using hdd_log to avoid printing function name */
 		hdd_nofl_debug("%s: %d: %d: %ums",
 			       hdd_reason_type_to_string(i),
-			       adapter->queue_oper_stats[i].pause_count,
-			       adapter->queue_oper_stats[i].
-			       unpause_count,
+			       q_stats.pause_count,
+			       q_stats.unpause_count,
 			       qdf_system_ticks_to_msecs(
-			       adapter->queue_oper_stats[i].
-			       total_pause_time + pause_delta));
+			       q_stats.total_pause_time));
 	}
 
-	hdd_nofl_debug("Netif queue operation history: Total entries: %d current index %d(-1) time %u",
+	hdd_nofl_debug("Netif queue operation history: Entries per cpu: %d time %u",
 		       WLAN_HDD_MAX_HISTORY_ENTRY,
-		       adapter->history_index,
 		       qdf_system_ticks_to_msecs(qdf_system_ticks()));
 
-	hdd_nofl_debug("%2s%20s%50s%30s%10s  %s",
-		       "#", "time(ms)", "action_type", "reason_type",
+	hdd_nofl_debug("%3s%20s%50s%30s%10s  %s",
+		       "cpu", "time(ms)", "action_type", "reason_type",
 		       "pause_map", "netdev-queue-status");
 
-	for (i = 0; i < WLAN_HDD_MAX_HISTORY_ENTRY; i++) {
-		/* using hdd_log to avoid printing function name */
-		if (adapter->queue_oper_history[i].time == 0)
-			continue;
-		q_hist_ptr = &adapter->queue_oper_history[i];
-		wlan_hdd_dump_queue_history_state(q_hist_ptr,
-						  q_status_buf,
-						  sizeof(q_status_buf));
-		hdd_nofl_debug("%2d%20u%50s%30s%10x  %s",
-			       i, qdf_system_ticks_to_msecs(
-				adapter->queue_oper_history[i].time),
-				   hdd_action_type_to_string(
-				adapter->queue_oper_history[i].
-					netif_action),
-				   hdd_reason_type_to_string(
-				adapter->queue_oper_history[i].
-					netif_reason),
-				   adapter->queue_oper_history[i].pause_map,
-				   q_status_buf);
+	for (cpu = 0; cpu < NUM_CPUS; cpu++) {
+		cpu_hist = &adapter->queue_oper_history[cpu];
+		index = qdf_atomic_read(&cpu_hist->index);
+
+		/* oldest entry first */
+		for (i = 0; i < WLAN_HDD_MAX_HISTORY_ENTRY; i++) {
+			q_hist_ptr = &cpu_hist->entry[(index + i) &
+					(WLAN_HDD_MAX_HISTORY_ENTRY - 1)];
+			if (q_hist_ptr->time == 0)
+				continue;
+			wlan_hdd_dump_queue_history_state(q_hist_ptr,
+							  q_status_buf,
+							  sizeof(q_status_buf));
+			/* using hdd_log to avoid printing function name */
+			hdd_nofl_debug("%3d%20u%50s%30s%10x  %s",
+				       cpu,
+				       qdf_system_ticks_to_msecs(
+						q_hist_ptr->time),
+				       hdd_action_type_to_string(
+						q_hist_ptr->netif_action),
+				       hdd_reason_type_to_string(
+						q_hist_ptr->netif_reason),
+				       q_hist_ptr->pause_map,
+				       q_status_buf);
+		}
 	}
 }
 
@@ -11281,18 +11690,22 @@ wlan_hdd_display_netif_queue_history(struct hdd_context *hdd_ctx,
 void wlan_hdd_clear_netif_queue_history(struct hdd_context *hdd_ctx)
 {
 	struct hdd_adapter *adapter = NULL, *next_adapter = NULL;
+	int i;
 	wlan_net_dev_ref_dbgid dbgid = NET_DEV_HOLD_CLEAR_NETIF_QUEUE_HISTORY;
 
 	hdd_for_each_adapter_dev_held_safe(hdd_ctx, adapter, next_adapter,
 					   dbgid) {
-		qdf_mem_zero(adapter->queue_oper_stats,
-					sizeof(adapter->queue_oper_stats));
 		qdf_mem_zero(adapter->queue_oper_history,
 					sizeof(adapter->queue_oper_history));
-		adapter->history_index = 0;
+		spin_lock_bh(&adapter->pause_map_lock);
+		qdf_mem_zero(adapter->reason_pause_time,
+			     sizeof(adapter->reason_pause_time));
 		adapter->start_time = adapter->last_time = qdf_system_ticks();
+		for (i = 0; i < WLAN_REASON_TYPE_MAX; i++)
+			adapter->reason_pause_start[i] = adapter->start_time;
 		adapter->total_pause_time = 0;
 		adapter->total_unpause_time = 0;
+		spin_unlock_bh(&adapter->pause_map_lock);
 		hdd_adapter_dev_put_debug(adapter, dbgid);
 	}
 }
@@ -15281,6 +15694,7 @@ int hdd_wlan_startup(struct hdd_context *hdd_ctx)
 	hdd_set_idle_ps_config(hdd_ctx, is_imps_enabled);
 	hdd_debugfs_mws_coex_info_init(hdd_ctx);
 	hdd_debugfs_ini_config_init(hdd_ctx);
+	hdd_debugfs_dp_latency_init(hdd_ctx);
 	wlan_hdd_debugfs_unit_test_host_create(hdd_ctx);
 	wlan_hdd_create_mib_stats_lock();
 	wlan_cfg80211_init_interop_issues_ap(hdd_ctx->pdev);
@@ -16061,6 +16475,8 @@ static void __hdd_bus_bw_compute_timer_start(struct hdd_context *hdd_ctx)
 {
 	qdf_periodic_work_start(&hdd_ctx->bus_bw_work,
 				hdd_ctx->config->bus_bw_compute_interval);
+	if (hdd_ctx->bus_bw_escalate_work_init)
+		qdf_atomic_set(&hdd_ctx->bus_bw_escalate_active, 1);
 }
 
 void hdd_bus_bw_compute_timer_start(struct hdd_context *hdd_ctx)
@@ -16097,6 +16513,18 @@ static void __hdd_bus_bw_compute_timer_stop(struct hdd_context *hdd_ctx)
 					   OL_TXRX_PDEV_ID);
 
 exit:
+	/*
+	 * Stop accepting escalations and wait for a queued one, so that the
+	 * TPUT_LEVEL_NONE vote below is the last tput vote until the timer
+	 * is started again.
+	 */
+	if (hdd_ctx->bus_bw_escalate_work_init) {
+		qdf_atomic_set(&hdd_ctx->bus_bw_escalate_active, 0);
+		qdf_flush_work(&hdd_ctx->bus_bw_escalate_work);
+	}
+	hdd_bus_bw_predict_reset(hdd_ctx);
+	hdd_tcp_rx_tune_reset(hdd_ctx);
+
 	/**
 	 * This check if for the case where the bus bw timer is forcibly
 	 * stopped. We should remove the bus bw voting, if no adapter is
@@ -42,7 +42,7 @@ void hdd_periodic_sta_stats_init(struct hdd_adapter *adapter)
 void hdd_periodic_sta_stats_display(struct hdd_context *hdd_ctx)
 {
 	struct hdd_adapter *adapter, *next_adapter = NULL;
-	struct hdd_stats sta_stats;
+	struct hdd_stats *sta_stats;
 	struct hdd_config *hdd_cfg;
 	char *dev_name;
 	bool should_log;
@@ -84,15 +84,15 @@ void hdd_periodic_sta_stats_display(struct hdd_context *hdd_ctx)
 
 		if (should_log) {
 			dev_name = WLAN_HDD_GET_DEV_NAME(adapter);
-			sta_stats = adapter->hdd_stats;
+			sta_stats = &adapter->hdd_stats;
 			hdd_nofl_info("%s: Tx ARP requests: %d", dev_name,
-				      sta_stats.hdd_arp_stats.tx_arp_req_count);
+				      sta_stats->hdd_arp_stats.tx_arp_req_count);
 			hdd_nofl_info("%s: Rx ARP responses: %d", dev_name,
-				      sta_stats.hdd_arp_stats.rx_arp_rsp_count);
+				      sta_stats->hdd_arp_stats.rx_arp_rsp_count);
 			hdd_nofl_info("%s: Tx DNS requests: %d", dev_name,
-				      sta_stats.hdd_dns_stats.tx_dns_req_count);
+				      sta_stats->hdd_dns_stats.tx_dns_req_count);
 			hdd_nofl_info("%s: Rx DNS responses: %d", dev_name,
-				      sta_stats.hdd_dns_stats.rx_dns_rsp_count);
+				      sta_stats->hdd_dns_stats.rx_dns_rsp_count);
 		}
 		hdd_adapter_dev_put_debug(adapter, dbgid);
 	}
@@ -36,6 +36,7 @@ void hdd_rx_monitor_callback(ol_osif_vdev_handle context,
 	struct sk_buff *skb;
 	struct sk_buff *skb_next;
 	unsigned int cpu_index;
+	struct hdd_rx_cpu_stats *rx_stats;
 
 	qdf_assert(context);
 	qdf_assert(rxbuf);
@@ -48,6 +49,7 @@ void hdd_rx_monitor_callback(ol_osif_vdev_handle context,
 	}
 
 	cpu_index = wlan_hdd_get_cpu();
+	rx_stats = &adapter->hdd_stats.tx_rx_stats.rx_cpu[cpu_index];
 
 	/* walk the chain until all are processed */
 	skb = (struct sk_buff *)rxbuf;
@@ -55,7 +57,7 @@ void hdd_rx_monitor_callback(ol_osif_vdev_handle context,
 		skb_next = skb->next;
 		skb->dev = adapter->dev;
 
-		++adapter->hdd_stats.tx_rx_stats.rx_packets[cpu_index];
+		++rx_stats->rx_packets;
 		++adapter->stats.rx_packets;
 		adapter->stats.rx_bytes += skb->len;
 
@@ -79,10 +81,9 @@ void hdd_rx_monitor_callback(ol_osif_vdev_handle context,
 		}
 
 		if (NET_RX_SUCCESS == rxstat)
-			++adapter->
-				hdd_stats.tx_rx_stats.rx_delivered[cpu_index];
+			++rx_stats->rx_delivered;
 		else
-			++adapter->hdd_stats.tx_rx_stats.rx_refused[cpu_index];
+			++rx_stats->rx_refused;
 
 		skb = skb_next;
 	}
@@ -1100,6 +1100,7 @@ QDF_STATUS hdd_softap_rx_packet_cbk(void *adapter_context, qdf_nbuf_t rx_buf)
 	struct hdd_adapter *adapter = NULL;
 	QDF_STATUS qdf_status;
 	unsigned int cpu_index;
+	struct hdd_rx_cpu_stats *rx_stats;
 	struct sk_buff *skb = NULL;
 	struct sk_buff *next = NULL;
 	struct hdd_context *hdd_ctx = NULL;
@@ -1155,7 +1156,8 @@ QDF_STATUS hdd_softap_rx_packet_cbk(void *adapter_context, qdf_nbuf_t rx_buf)
 			continue;
 		}
 		cpu_index = wlan_hdd_get_cpu();
-		++adapter->hdd_stats.tx_rx_stats.rx_packets[cpu_index];
+		rx_stats = &adapter->hdd_stats.tx_rx_stats.rx_cpu[cpu_index];
+		++rx_stats->rx_packets;
 		++adapter->stats.rx_packets;
 		/* count aggregated RX frame into stats */
 		adapter->stats.rx_packets += qdf_nbuf_get_gso_segs(skb);
@@ -1233,9 +1235,9 @@ QDF_STATUS hdd_softap_rx_packet_cbk(void *adapter_context, qdf_nbuf_t rx_buf)
 		qdf_status = hdd_rx_deliver_to_stack(adapter, skb);
 
 		if (QDF_IS_STATUS_SUCCESS(qdf_status))
-			++adapter->hdd_stats.tx_rx_stats.rx_delivered[cpu_index];
+			++rx_stats->rx_delivered;
 		else
-			++adapter->hdd_stats.tx_rx_stats.rx_refused[cpu_index];
+			++rx_stats->rx_refused;
 	}
 
 	return QDF_STATUS_SUCCESS;
@@ -6640,17 +6640,12 @@ void wlan_hdd_display_txrx_stats(struct hdd_context *ctx)
 {
 	struct hdd_adapter *adapter = NULL, *next_adapter = NULL;
 	struct hdd_tx_rx_stats *stats;
-	int i = 0;
-	uint32_t total_rx_pkt, total_rx_dropped,
-		 total_rx_delv, total_rx_refused;
+	struct hdd_rx_cpu_stats rx_stats, *cpu_stats;
+	int i;
 	wlan_net_dev_ref_dbgid dbgid = NET_DEV_HOLD_CACHE_STATION_STATS_CB;
 
 	hdd_for_each_adapter_dev_held_safe(ctx, adapter, next_adapter,
 					   dbgid) {
-		total_rx_pkt = 0;
-		total_rx_dropped = 0;
-		total_rx_delv = 0;
-		total_rx_refused = 0;
 		stats = &adapter->hdd_stats.tx_rx_stats;
 
 		if (adapter->vdev_id == INVAL_VDEV_ID) {
@@ -6659,12 +6654,7 @@ void wlan_hdd_display_txrx_stats(struct hdd_context *ctx)
 		}
 
 		hdd_debug("adapter: %u", adapter->vdev_id);
-		for (; i < NUM_CPUS; i++) {
-			total_rx_pkt += stats->rx_packets[i];
-			total_rx_dropped += stats->rx_dropped[i];
-			total_rx_delv += stats->rx_delivered[i];
-			total_rx_refused += stats->rx_refused[i];
-		}
+		hdd_get_rx_cpu_stats_sum(stats, &rx_stats);
 
 		/* dev_put has to be done here */
 		hdd_adapter_dev_put_debug(adapter, dbgid);
@@ -6674,20 +6664,23 @@ void wlan_hdd_display_txrx_stats(struct hdd_context *ctx)
 			  stats->tx_orphaned);
 
 		for (i = 0; i < NUM_CPUS; i++) {
-			if (stats->rx_packets[i] == 0)
+			cpu_stats = &stats->rx_cpu[i];
+			if (cpu_stats->rx_packets == 0)
 				continue;
 			hdd_debug("Rx CPU[%d]: packets %u, dropped %u, delivered %u, refused %u",
-				  i, stats->rx_packets[i], stats->rx_dropped[i],
-				  stats->rx_delivered[i], stats->rx_refused[i]);
+				  i, cpu_stats->rx_packets,
+				  cpu_stats->rx_dropped,
+				  cpu_stats->rx_delivered,
+				  cpu_stats->rx_refused);
 		}
 		hdd_debug("RX - packets %u, dropped %u, unsolict_arp_n_mcast_drp %u, delivered %u, refused %u GRO - agg %u drop %u non-agg %u flush_skip %u low_tput_flush %u disabled(conc %u low-tput %u)",
-			  total_rx_pkt, total_rx_dropped,
-			  qdf_atomic_read(&stats->rx_usolict_arp_n_mcast_drp),
-			  total_rx_delv,
-			  total_rx_refused, stats->rx_aggregated,
-			  stats->rx_gro_dropped, stats->rx_non_aggregated,
-			  stats->rx_gro_flush_skip,
-			  stats->rx_gro_low_tput_flush,
+			  rx_stats.rx_packets, rx_stats.rx_dropped,
+			  rx_stats.rx_usolict_arp_n_mcast_drp,
+			  rx_stats.rx_delivered,
+			  rx_stats.rx_refused, rx_stats.rx_aggregated,
+			  rx_stats.rx_gro_dropped, rx_stats.rx_non_aggregated,
+			  rx_stats.rx_gro_flush_skip,
+			  rx_stats.rx_gro_low_tput_flush,
 			  qdf_atomic_read(&ctx->disable_rx_ol_in_concurrency),
 			  qdf_atomic_read(&ctx->disable_rx_ol_in_low_tput));
 	}
@@ -76,6 +76,8 @@
 #include <wlan_hdd_sysfs_dp_aggregation.h>
 #include <wlan_hdd_sysfs_dl_modes.h>
 #include <wlan_hdd_sysfs_swlm.h>
+#include <wlan_hdd_sysfs_bus_bw_trace.h>
+#include <wlan_hdd_sysfs_tcp_rx_tune.h>
 #include "wma_api.h"
 
 #define MAX_PSOC_ID_SIZE 10
@@ -840,6 +842,8 @@ void hdd_create_sysfs_files(struct hdd_context *hdd_ctx)
 		hdd_sysfs_pm_dbs_create(driver_kobject);
 		hdd_sysfs_dp_aggregation_create(driver_kobject);
 		hdd_sysfs_dp_swlm_create(driver_kobject);
+		hdd_sysfs_bus_bw_trace_create(driver_kobject);
+		hdd_sysfs_tcp_rx_tune_create(driver_kobject);
 		hdd_sysfs_create_wakeup_logs_to_console();
 	}
 }
@@ -848,6 +852,8 @@ void hdd_destroy_sysfs_files(void)
 {
 	if  (QDF_GLOBAL_MISSION_MODE == hdd_get_conparam()) {
 		hdd_sysfs_destroy_wakeup_logs_to_console();
+		hdd_sysfs_tcp_rx_tune_destroy(driver_kobject);
+		hdd_sysfs_bus_bw_trace_destroy(driver_kobject);
 		hdd_sysfs_dp_swlm_destroy(driver_kobject);
 		hdd_sysfs_dp_aggregation_destroy(driver_kobject);
 		hdd_sysfs_pm_dbs_destroy(driver_kobject);
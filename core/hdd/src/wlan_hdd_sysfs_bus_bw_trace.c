@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2021 The Linux Foundation. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: wlan_hdd_sysfs_bus_bw_trace.c
+ *
+ * implementation for creating sysfs files:
+ *
+ * bus_bw_trace
+ */
+
+#include <wlan_hdd_includes.h>
+#include "osif_psoc_sync.h"
+#include <wlan_hdd_sysfs.h>
+#include <wlan_hdd_sysfs_bus_bw_trace.h>
+
+/* Longest record line: 5 u64, 7 u32 and the separators */
+#define HDD_BUS_BW_TRACE_LINE_LEN	192
+/* Room kept at the end of the page for the dropped records line */
+#define HDD_BUS_BW_TRACE_DROP_LEN	32
+
+/**
+ * hdd_sysfs_bus_bw_trace_replay() - Replay a trace record with the replay
+ *  thresholds
+ * @thres: replay thresholds
+ * @rec: trace record
+ * @tput_level: replayed throughput level
+ * @bbm_vote: replayed bus bw manager vote
+ *
+ * Only the recorded state is used, so the replay gives the same result
+ * regardless of the connections at the time the trace is read.
+ *
+ * Return: None
+ */
+static void
+hdd_sysfs_bus_bw_trace_replay(const struct hdd_bus_bw_thresholds *thres,
+			      const struct hdd_bus_bw_trace_rec *rec,
+			      enum tput_level *tput_level,
+			      enum bus_bw_level *bbm_vote)
+{
+	enum bus_bw_level votes[BBM_MAX_POLICY];
+	enum bus_bw_level tput_votes[TPUT_LEVEL_MAX];
+	enum tput_level level;
+	enum bbm_policy i;
+
+	for (i = 0; i < BBM_MAX_POLICY; i++)
+		votes[i] = rec->policy_vote[i];
+	for (level = TPUT_LEVEL_NONE; level < TPUT_LEVEL_MAX; level++)
+		tput_votes[level] = rec->tput_policy_vote[level];
+
+	*tput_level = hdd_bus_bw_thres_to_tput_level(thres,
+						     rec->tx_packets +
+						     rec->rx_packets);
+	*bbm_vote = hdd_bbm_replay_tput_policy(votes, tput_votes, *tput_level);
+}
+
+/**
+ * __hdd_sysfs_bus_bw_trace_show() - Print the bus bw trace
+ * @hdd_ctx: HDD context
+ * @attr: sysfs attribute
+ * @buf: output page
+ *
+ * Records are printed newest first. The whole ring does not always fit
+ * in one page, so printing stops at the first record that does not fit
+ * and the number of older records left out is reported instead.
+ *
+ * Return: number of bytes written to @buf or errno
+ */
+static ssize_t
+__hdd_sysfs_bus_bw_trace_show(struct hdd_context *hdd_ctx,
+			      struct kobj_attribute *attr, char *buf)
+{
+	char line[HDD_BUS_BW_TRACE_LINE_LEN];
+	struct hdd_bus_bw_trace *trace;
+	struct hdd_bus_bw_trace_rec *rec;
+	enum tput_level rp_tput_level;
+	enum bus_bw_level rp_bbm_vote;
+	uint32_t i, line_len;
+	ssize_t len;
+
+	if (!wlan_hdd_validate_modules_state(hdd_ctx))
+		return -EINVAL;
+
+	trace = qdf_mem_malloc(sizeof(*trace));
+	if (!trace)
+		return -ENOMEM;
+
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	qdf_mem_copy(trace, &hdd_ctx->bus_bw_trace, sizeof(*trace));
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+
+	len = scnprintf(buf, PAGE_SIZE,
+			"thres %u %u %u %u replay %u %u %u %u\n",
+			hdd_ctx->config->bus_bw_very_high_threshold,
+			hdd_ctx->config->bus_bw_high_threshold,
+			hdd_ctx->config->bus_bw_medium_threshold,
+			hdd_ctx->config->bus_bw_low_threshold,
+			trace->replay ? trace->replay_thres.very_high : 0,
+			trace->replay ? trace->replay_thres.high : 0,
+			trace->replay ? trace->replay_thres.medium : 0,
+			trace->replay ? trace->replay_thres.low : 0);
+	len += scnprintf(buf + len, PAGE_SIZE - len,
+			 "qtime tx rx no_tx_ol no_rx_ol tput vote rx_lvl tx_lvl bbm%s\n",
+			 trace->replay ? " rp_tput rp_bbm" : "");
+
+	for (i = 0; i < trace->count; i++) {
+		rec = &trace->rec[(trace->idx + HDD_BUS_BW_TRACE_SIZE - 1 - i) %
+				  HDD_BUS_BW_TRACE_SIZE];
+		line_len = scnprintf(line, sizeof(line),
+				     "%llu %llu %llu %llu %llu %u %u %u %u %u",
+				     rec->qtime, rec->tx_packets,
+				     rec->rx_packets, rec->no_tx_offload_pkts,
+				     rec->no_rx_offload_pkts, rec->tput_level,
+				     rec->vote_level, rec->rx_level,
+				     rec->tx_level, rec->bbm_vote);
+		if (trace->replay) {
+			hdd_sysfs_bus_bw_trace_replay(&trace->replay_thres,
+						      rec, &rp_tput_level,
+						      &rp_bbm_vote);
+			line_len += scnprintf(line + line_len,
+					      sizeof(line) - line_len,
+					      " %u %u", rp_tput_level,
+					      rp_bbm_vote);
+		}
+		line_len += scnprintf(line + line_len, sizeof(line) - line_len,
+				      "\n");
+
+		if (len + line_len + HDD_BUS_BW_TRACE_DROP_LEN >= PAGE_SIZE)
+			break;
+
+		qdf_mem_copy(buf + len, line, line_len);
+		len += line_len;
+	}
+
+	if (i < trace->count)
+		len += scnprintf(buf + len, PAGE_SIZE - len,
+				 "dropped %u older records\n",
+				 trace->count - i);
+
+	qdf_mem_free(trace);
+
+	return len;
+}
+
+static ssize_t hdd_sysfs_bus_bw_trace_show(struct kobject *kobj,
+					   struct kobj_attribute *attr,
+					   char *buf)
+{
+	struct osif_psoc_sync *psoc_sync;
+	struct hdd_context *hdd_ctx = cds_get_context(QDF_MODULE_ID_HDD);
+	ssize_t errno_size;
+	int ret;
+
+	ret = wlan_hdd_validate_context(hdd_ctx);
+	if (ret != 0)
+		return ret;
+
+	errno_size = osif_psoc_sync_op_start(wiphy_dev(hdd_ctx->wiphy),
+					     &psoc_sync);
+	if (errno_size)
+		return errno_size;
+
+	errno_size = __hdd_sysfs_bus_bw_trace_show(hdd_ctx, attr, buf);
+
+	osif_psoc_sync_op_stop(psoc_sync);
+
+	return errno_size;
+}
+
+static ssize_t
+__hdd_sysfs_bus_bw_trace_store(struct hdd_context *hdd_ctx,
+			       struct kobj_attribute *attr, const char *buf,
+			       size_t count)
+{
+	char buf_local[MAX_SYSFS_USER_COMMAND_SIZE_LENGTH + 1];
+	struct hdd_bus_bw_thresholds thres;
+	uint32_t value[4];
+	char *sptr, *token;
+	int ret, i;
+
+	if (!wlan_hdd_validate_modules_state(hdd_ctx))
+		return -EINVAL;
+
+	ret = hdd_sysfs_validate_and_copy_buf(buf_local, sizeof(buf_local),
+					      buf, count);
+	if (ret) {
+		hdd_err_rl("invalid input");
+		return ret;
+	}
+
+	sptr = buf_local;
+	for (i = 0; i < QDF_ARRAY_SIZE(value); i++) {
+		token = strsep(&sptr, " ");
+		if (!token)
+			break;
+		if (kstrtou32(token, 0, &value[i]))
+			return -EINVAL;
+	}
+
+	if (i == 1 && !value[0]) {
+		hdd_debug("bus_bw_trace: replay off");
+		qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+		hdd_ctx->bus_bw_trace.replay = false;
+		qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+		return count;
+	}
+
+	if (i != QDF_ARRAY_SIZE(value))
+		return -EINVAL;
+
+	thres.very_high = value[0];
+	thres.high = value[1];
+	thres.medium = value[2];
+	thres.low = value[3];
+	if (thres.very_high < thres.high || thres.high < thres.medium ||
+	    thres.medium < thres.low) {
+		hdd_err_rl("bus_bw_trace: thresholds must not increase");
+		return -EINVAL;
+	}
+
+	hdd_debug("bus_bw_trace: replay %u %u %u %u", thres.very_high,
+		  thres.high, thres.medium, thres.low);
+
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	hdd_ctx->bus_bw_trace.replay_thres = thres;
+	hdd_ctx->bus_bw_trace.replay = true;
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+
+	return count;
+}
+
+static ssize_t
+hdd_sysfs_bus_bw_trace_store(struct kobject *kobj,
+			     struct kobj_attribute *attr,
+			     char const *buf, size_t count)
+{
+	struct osif_psoc_sync *psoc_sync;
+	struct hdd_context *hdd_ctx = cds_get_context(QDF_MODULE_ID_HDD);
+	ssize_t errno_size;
+	int ret;
+
+	ret = wlan_hdd_validate_context(hdd_ctx);
+	if (ret != 0)
+		return ret;
+
+	errno_size = osif_psoc_sync_op_start(wiphy_dev(hdd_ctx->wiphy),
+					     &psoc_sync);
+	if (errno_size)
+		return errno_size;
+
+	errno_size = __hdd_sysfs_bus_bw_trace_store(hdd_ctx, attr,
+						    buf, count);
+
+	osif_psoc_sync_op_stop(psoc_sync);
+
+	return errno_size;
+}
+
+static struct kobj_attribute bus_bw_trace_attribute =
+	__ATTR(bus_bw_trace, 0664, hdd_sysfs_bus_bw_trace_show,
+	       hdd_sysfs_bus_bw_trace_store);
+
+int hdd_sysfs_bus_bw_trace_create(struct kobject *driver_kobject)
+{
+	int error;
+
+	if (!driver_kobject) {
+		hdd_err("could not get driver kobject!");
+		return -EINVAL;
+	}
+
+	error = sysfs_create_file(driver_kobject,
+				  &bus_bw_trace_attribute.attr);
+	if (error)
+		hdd_err("could not create bus_bw_trace sysfs file");
+
+	return error;
+}
+
+void hdd_sysfs_bus_bw_trace_destroy(struct kobject *driver_kobject)
+{
+	if (!driver_kobject) {
+		hdd_err("could not get driver kobject!");
+		return;
+	}
+
+	sysfs_remove_file(driver_kobject, &bus_bw_trace_attribute.attr);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021 The Linux Foundation. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: wlan_hdd_sysfs_bus_bw_trace.h
+ *
+ * implementation for creating sysfs files:
+ *
+ * bus_bw_trace
+ */
+
+#ifndef _WLAN_HDD_SYSFS_BUS_BW_TRACE_H
+#define _WLAN_HDD_SYSFS_BUS_BW_TRACE_H
+
+#if defined(WLAN_SYSFS) && defined(WLAN_SYSFS_BUS_BW_TRACE)
+/**
+ * hdd_sysfs_bus_bw_trace_create() - API to create bus bw trace sysfs entry
+ * @driver_kobject: sysfs driver kobject
+ *
+ * file path: /sys/kernel/wifi/bus_bw_trace
+ *
+ * Reading the file dumps the last HDD_BUS_BW_TRACE_SIZE bus bandwidth
+ * compute intervals, oldest first. When replay thresholds are set each
+ * record also shows the throughput level and bus vote the same policy code
+ * selects with those thresholds.
+ *
+ * usage:
+ *      echo <very_high> <high> <medium> <low> > bus_bw_trace
+ *      echo 0 > bus_bw_trace
+ *
+ * Return: 0 on success and errno on failure
+ */
+int hdd_sysfs_bus_bw_trace_create(struct kobject *driver_kobject);
+
+/**
+ * hdd_sysfs_bus_bw_trace_destroy() - API to destroy bus bw trace sysfs entry
+ * @driver_kobject: sysfs driver kobject
+ *
+ * Return: None
+ */
+void hdd_sysfs_bus_bw_trace_destroy(struct kobject *driver_kobject);
+#else
+static inline int
+hdd_sysfs_bus_bw_trace_create(struct kobject *driver_kobject)
+{
+	return 0;
+}
+
+static inline void
+hdd_sysfs_bus_bw_trace_destroy(struct kobject *driver_kobject)
+{
+}
+#endif
+#endif /* #ifndef _WLAN_HDD_SYSFS_BUS_BW_TRACE_H */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 The Linux Foundation. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: wlan_hdd_sysfs_tcp_rx_tune.c
+ *
+ * implementation for creating sysfs files:
+ *
+ * tcp_rx_tune
+ */
+
+#include <wlan_hdd_includes.h>
+#include "osif_psoc_sync.h"
+#include <wlan_hdd_sysfs.h>
+#include <wlan_hdd_sysfs_tcp_rx_tune.h>
+
+static ssize_t
+__hdd_sysfs_tcp_rx_tune_show(struct hdd_context *hdd_ctx,
+			     struct kobj_attribute *attr, char *buf)
+{
+	struct hdd_tcp_rx_tune tune;
+
+	if (!wlan_hdd_validate_modules_state(hdd_ctx))
+		return -EINVAL;
+
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	tune = hdd_ctx->tcp_rx_tune;
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
+
+	return scnprintf(buf, PAGE_SIZE,
+			 "enabled %u\n"
+			 "rx_level %d\n"
+			 "srtt_us %u\n"
+			 "rtt_samples %u\n"
+			 "rx_pps %llu\n"
+			 "pkts_per_rtt %llu\n"
+			 "phy_rate_mbps %u\n"
+			 "delack_seg %u\n"
+			 "win_scale %u\n"
+			 "updates %u\n"
+			 "qtime %llu\n",
+			 hdd_ctx->config->tcp_rx_adaptive_tuning &&
+			 hdd_ctx->config->enable_tcp_param_update,
+			 hdd_ctx->cur_rx_level, tune.srtt_us >> 3,
+			 tune.rtt_samples, tune.rx_pps, tune.pkts_per_rtt,
+			 tune.phy_rate, tune.delack_seg, tune.win_scale,
+			 tune.updates, tune.qtime);
+}
+
+static ssize_t hdd_sysfs_tcp_rx_tune_show(struct kobject *kobj,
+					  struct kobj_attribute *attr,
+					  char *buf)
+{
+	struct osif_psoc_sync *psoc_sync;
+	struct hdd_context *hdd_ctx = cds_get_context(QDF_MODULE_ID_HDD);
+	ssize_t errno_size;
+	int ret;
+
+	ret = wlan_hdd_validate_context(hdd_ctx);
+	if (ret != 0)
+		return ret;
+
+	errno_size = osif_psoc_sync_op_start(wiphy_dev(hdd_ctx->wiphy),
+					     &psoc_sync);
+	if (errno_size)
+		return errno_size;
+
+	errno_size = __hdd_sysfs_tcp_rx_tune_show(hdd_ctx, attr, buf);
+
+	osif_psoc_sync_op_stop(psoc_sync);
+
+	return errno_size;
+}
+
+static struct kobj_attribute tcp_rx_tune_attribute =
+	__ATTR(tcp_rx_tune, 0444, hdd_sysfs_tcp_rx_tune_show, NULL);
+
+int hdd_sysfs_tcp_rx_tune_create(struct kobject *driver_kobject)
+{
+	int error;
+
+	if (!driver_kobject) {
+		hdd_err("could not get driver kobject!");
+		return -EINVAL;
+	}
+
+	error = sysfs_create_file(driver_kobject,
+				  &tcp_rx_tune_attribute.attr);
+	if (error)
+		hdd_err("could not create tcp_rx_tune sysfs file");
+
+	return error;
+}
+
+void hdd_sysfs_tcp_rx_tune_destroy(struct kobject *driver_kobject)
+{
+	if (!driver_kobject) {
+		hdd_err("could not get driver kobject!");
+		return;
+	}
+
+	sysfs_remove_file(driver_kobject, &tcp_rx_tune_attribute.attr);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2021 The Linux Foundation. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: wlan_hdd_sysfs_tcp_rx_tune.h
+ *
+ * implementation for creating sysfs files:
+ *
+ * tcp_rx_tune
+ */
+
+#ifndef _WLAN_HDD_SYSFS_TCP_RX_TUNE_H
+#define _WLAN_HDD_SYSFS_TCP_RX_TUNE_H
+
+#if defined(WLAN_SYSFS) && defined(WLAN_SYSFS_TCP_RX_TUNE)
+/**
+ * hdd_sysfs_tcp_rx_tune_create() - API to create tcp rx tune sysfs entry
+ * @driver_kobject: sysfs driver kobject
+ *
+ * file path: /sys/kernel/wifi/tcp_rx_tune
+ *
+ * Reading the file shows the inputs of the adaptive TCP rx parameter
+ * controller and the delayed ack segment count and adv window scale it
+ * last indicated.
+ *
+ * usage:
+ *      cat tcp_rx_tune
+ *
+ * Return: 0 on success and errno on failure
+ */
+int hdd_sysfs_tcp_rx_tune_create(struct kobject *driver_kobject);
+
+/**
+ * hdd_sysfs_tcp_rx_tune_destroy() - API to destroy tcp rx tune sysfs entry
+ * @driver_kobject: sysfs driver kobject
+ *
+ * Return: None
+ */
+void hdd_sysfs_tcp_rx_tune_destroy(struct kobject *driver_kobject);
+#else
+static inline int
+hdd_sysfs_tcp_rx_tune_create(struct kobject *driver_kobject)
+{
+	return 0;
+}
+
+static inline void
+hdd_sysfs_tcp_rx_tune_destroy(struct kobject *driver_kobject)
+{
+}
+#endif
+#endif /* #ifndef _WLAN_HDD_SYSFS_TCP_RX_TUNE_H */
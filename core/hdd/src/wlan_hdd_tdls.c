@@ -42,6 +42,7 @@
 #include "wlan_policy_mgr_api.h"
 #include <qca_vendor.h>
 #include "wlan_tdls_cfg_api.h"
+#include "wlan_tdls_ucfg_api.h"
 #include "wlan_hdd_object_manager.h"
 #include <wlan_reg_ucfg_api.h>
 
@@ -863,6 +864,100 @@ QDF_STATUS hdd_tdls_register_peer(void *userdata, uint32_t vdev_id,
 	return hdd_roam_register_tdlssta(adapter, mac, qos);
 }
 
+/**
+ * hdd_tdls_ct_hash() - hash a peer mac address into a batch slot
+ * @mac: peer mac address
+ *
+ * Return: slot index
+ */
+static inline uint8_t hdd_tdls_ct_hash(struct qdf_mac_addr *mac)
+{
+	return (mac->bytes[4] ^ mac->bytes[5]) & (HDD_TDLS_CT_BATCH_SLOTS - 1);
+}
+
+void hdd_tdls_ct_count(struct hdd_adapter *adapter, int cpu,
+		       struct qdf_mac_addr *mac, bool is_tx)
+{
+	struct hdd_context *hdd_ctx = adapter->hdd_ctx;
+	struct hdd_station_ctx *sta_ctx;
+	struct hdd_tdls_ct_slot *slot;
+	uint8_t idx;
+	uint8_t i;
+
+	if (!hdd_ctx->tdls_umac_comp_active ||
+	    !ucfg_tdls_is_ct_enabled(hdd_ctx->psoc))
+		return;
+
+	if (qdf_unlikely(cpu < 0 || cpu >= NUM_CPUS))
+		return;
+
+	if (qdf_is_macaddr_group(mac))
+		return;
+
+	/* Traffic with the AP never makes a TDLS candidate */
+	sta_ctx = WLAN_HDD_GET_STATION_CTX_PTR(adapter);
+	if (qdf_is_macaddr_equal(mac, &sta_ctx->conn_info.bssid))
+		return;
+
+	idx = hdd_tdls_ct_hash(mac);
+	for (i = 0; i < HDD_TDLS_CT_BATCH_SLOTS; i++) {
+		slot = &adapter->tdls_ct_batch[cpu].slot[
+				(idx + i) & (HDD_TDLS_CT_BATCH_SLOTS - 1)];
+		if (qdf_is_macaddr_equal(&slot->mac, mac))
+			break;
+		if (!slot->tx_cnt && !slot->rx_cnt) {
+			qdf_copy_macaddr(&slot->mac, mac);
+			break;
+		}
+	}
+
+	/* More peers than slots in this period, drop the sample */
+	if (i == HDD_TDLS_CT_BATCH_SLOTS)
+		return;
+
+	if (is_tx)
+		slot->tx_cnt++;
+	else
+		slot->rx_cnt++;
+}
+
+void hdd_tdls_ct_flush(void *userdata, struct wlan_objmgr_vdev *vdev)
+{
+	struct hdd_context *hdd_ctx = userdata;
+	struct hdd_adapter *adapter;
+	struct hdd_tdls_ct_slot *slot;
+	struct qdf_mac_addr mac;
+	uint32_t tx_cnt, rx_cnt;
+	int cpu;
+	uint8_t i;
+
+	if (!hdd_ctx || !vdev)
+		return;
+
+	adapter = hdd_get_adapter_by_vdev(hdd_ctx, wlan_vdev_get_id(vdev));
+	if (!adapter)
+		return;
+
+	for (cpu = 0; cpu < NUM_CPUS; cpu++) {
+		for (i = 0; i < HDD_TDLS_CT_BATCH_SLOTS; i++) {
+			slot = &adapter->tdls_ct_batch[cpu].slot[i];
+			tx_cnt = slot->tx_cnt;
+			rx_cnt = slot->rx_cnt;
+			if (!tx_cnt && !rx_cnt)
+				continue;
+
+			/*
+			 * Once the counts read zero the owning CPU may reuse
+			 * the slot for another peer, so copy the mac first.
+			 */
+			qdf_copy_macaddr(&mac, &slot->mac);
+			slot->tx_cnt = 0;
+			slot->rx_cnt = 0;
+			ucfg_tdls_update_pkt_cnt(vdev, &mac, tx_cnt, rx_cnt);
+		}
+	}
+}
+
 void hdd_init_tdls_config(struct tdls_start_params *tdls_cfg)
 {
 	tdls_cfg->tdls_send_mgmt_req = eWNI_SME_TDLS_SEND_MGMT_REQ;
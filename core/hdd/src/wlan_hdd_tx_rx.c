@@ -33,6 +33,11 @@
 #include <linux/etherdevice.h>
 #include <linux/if_ether.h>
 #include <linux/inetdevice.h>
+#include <linux/ip.h>
+#include <linux/ipv6.h>
+#include <linux/udp.h>
+#include <linux/jhash.h>
+#include <linux/hash.h>
 #include <cds_sched.h>
 #include <cds_utils.h>
 
@@ -572,6 +577,29 @@ void hdd_reset_all_adapters_connectivity_stats(struct hdd_context *hdd_ctx)
 	hdd_exit();
 }
 
+void hdd_get_rx_cpu_stats_sum(struct hdd_tx_rx_stats *stats,
+			      struct hdd_rx_cpu_stats *sum)
+{
+	struct hdd_rx_cpu_stats *cpu_stats;
+	int cpu;
+
+	qdf_mem_zero(sum, sizeof(*sum));
+	for (cpu = 0; cpu < NUM_CPUS; cpu++) {
+		cpu_stats = &stats->rx_cpu[cpu];
+		sum->rx_packets += cpu_stats->rx_packets;
+		sum->rx_dropped += cpu_stats->rx_dropped;
+		sum->rx_delivered += cpu_stats->rx_delivered;
+		sum->rx_refused += cpu_stats->rx_refused;
+		sum->rx_usolict_arp_n_mcast_drp +=
+				cpu_stats->rx_usolict_arp_n_mcast_drp;
+		sum->rx_aggregated += cpu_stats->rx_aggregated;
+		sum->rx_gro_dropped += cpu_stats->rx_gro_dropped;
+		sum->rx_non_aggregated += cpu_stats->rx_non_aggregated;
+		sum->rx_gro_flush_skip += cpu_stats->rx_gro_flush_skip;
+		sum->rx_gro_low_tput_flush += cpu_stats->rx_gro_low_tput_flush;
+	}
+}
+
 /**
  * hdd_is_tx_allowed() - check if Tx is allowed based on current peer state
  * @skb: pointer to OS packet (sk_buff)
@@ -1005,6 +1033,505 @@ static void hdd_mark_icmp_req_to_fw(struct hdd_context *hdd_ctx,
 }
 #endif
 
+/**
+ * hdd_flow_key_parse() - Compute a direction independent TCP/UDP flow key
+ * @skb: frame, data pointing at the ethernet header
+ * @l4_off: offset of the TCP/UDP header from the ethernet header
+ * @l4_proto: IP protocol of the flow
+ *
+ * Addresses and ports are folded symmetrically so that the tx and the rx
+ * frames of a flow map to the same key.
+ *
+ * Return: flow key, 0 if the frame is not part of a TCP/UDP flow
+ */
+static uint32_t hdd_flow_key_parse(struct sk_buff *skb, uint32_t *l4_off,
+				   uint8_t *l4_proto)
+{
+	struct ethhdr *eth;
+	struct iphdr *iph;
+	struct ipv6hdr *ip6h;
+	__be16 *ports;
+	uint32_t addr = 0;
+	uint32_t off;
+	uint8_t proto;
+	int i;
+
+	if (skb_headlen(skb) < ETH_HLEN)
+		return 0;
+
+	eth = (struct ethhdr *)skb->data;
+	switch (eth->h_proto) {
+	case htons(ETH_P_IP):
+		if (skb_headlen(skb) < ETH_HLEN + sizeof(*iph))
+			return 0;
+		iph = (struct iphdr *)(skb->data + ETH_HLEN);
+		if (iph->frag_off & htons(IP_MF | IP_OFFSET))
+			return 0;
+		addr = (__force uint32_t)(iph->saddr ^ iph->daddr);
+		proto = iph->protocol;
+		off = ETH_HLEN + iph->ihl * 4;
+		break;
+	case htons(ETH_P_IPV6):
+		if (skb_headlen(skb) < ETH_HLEN + sizeof(*ip6h))
+			return 0;
+		ip6h = (struct ipv6hdr *)(skb->data + ETH_HLEN);
+		for (i = 0; i < 4; i++)
+			addr ^= (__force uint32_t)(ip6h->saddr.s6_addr32[i] ^
+						   ip6h->daddr.s6_addr32[i]);
+		proto = ip6h->nexthdr;
+		off = ETH_HLEN + sizeof(*ip6h);
+		break;
+	default:
+		return 0;
+	}
+
+	if (proto != IPPROTO_TCP && proto != IPPROTO_UDP)
+		return 0;
+
+	if (skb_headlen(skb) < off + 2 * sizeof(*ports))
+		return 0;
+
+	ports = (__be16 *)(skb->data + off);
+	*l4_off = off;
+	*l4_proto = proto;
+
+	return jhash_3words(addr, (__force uint32_t)(ports[0] ^ ports[1]),
+			    proto, 0) | 1;
+}
+
+/**
+ * hdd_rps_flow_key() - Compute a direction independent TCP/UDP flow key
+ * @skb: frame, data pointing at the ethernet header
+ *
+ * Return: flow key, 0 if the frame is not part of a TCP/UDP flow
+ */
+static uint32_t hdd_rps_flow_key(struct sk_buff *skb)
+{
+	uint32_t l4_off;
+	uint8_t proto;
+
+	return hdd_flow_key_parse(skb, &l4_off, &proto);
+}
+
+/**
+ * hdd_rps_flow_learn() - Learn the consumer CPU of a locally sourced flow
+ * @adapter: adapter the frame is transmitted on
+ * @skb: tx frame
+ *
+ * Frames of local sockets are transmitted from the context of the
+ * application, so the current CPU is where rx of the flow is consumed.
+ *
+ * Return: None
+ */
+static void hdd_rps_flow_learn(struct hdd_adapter *adapter,
+			       struct sk_buff *skb)
+{
+	struct hdd_rps_flow *flow;
+	unsigned long now;
+	uint32_t key, cpu;
+
+	if (!adapter->rps_flow_steering || !skb->sk)
+		return;
+
+	key = hdd_rps_flow_key(skb);
+	if (!key)
+		return;
+
+	cpu = qdf_get_cpu();
+	now = qdf_system_ticks();
+	flow = &adapter->rps_flow_tbl[key & (HDD_RPS_FLOW_TBL_SIZE - 1)];
+
+	/* avoid dirtying the slot on every frame of a settled flow */
+	if (flow->key == key && flow->cpu == cpu &&
+	    !qdf_system_time_after(now, flow->last_seen +
+				   qdf_system_msecs_to_ticks(
+					HDD_RPS_FLOW_AGE_MS / 4)))
+		return;
+
+	flow->key = key;
+	flow->cpu = cpu;
+	flow->last_seen = now;
+}
+
+/**
+ * hdd_rps_flow_steer() - Steer an rx frame toward its consumer CPU
+ * @adapter: adapter the frame is received on
+ * @skb: rx frame, data pointing at the ethernet header
+ *
+ * Records the rx queue whose RPS mask holds the learned CPU of the flow.
+ * Frames of unknown or idle flows keep the default queue and hence the
+ * static RPS mask.
+ *
+ * Return: None
+ */
+static void hdd_rps_flow_steer(struct hdd_adapter *adapter,
+			       struct sk_buff *skb)
+{
+	struct hdd_rps_flow *flow;
+	uint32_t key, cpu;
+	uint8_t rxq;
+
+	key = hdd_rps_flow_key(skb);
+	if (!key)
+		return;
+
+	flow = &adapter->rps_flow_tbl[key & (HDD_RPS_FLOW_TBL_SIZE - 1)];
+	if (flow->key != key)
+		return;
+
+	if (qdf_system_time_after(qdf_system_ticks(), flow->last_seen +
+				  qdf_system_msecs_to_ticks(
+					HDD_RPS_FLOW_AGE_MS)))
+		return;
+
+	cpu = flow->cpu;
+	if (cpu >= NUM_CPUS)
+		return;
+
+	rxq = adapter->rps_cpu_rxq[cpu];
+	if (rxq)
+		skb_record_rx_queue(skb, rxq);
+}
+
+/**
+ * hdd_rps_flow_update_rxq_map() - Pick the steering rx queue of each CPU
+ * @adapter: adapter whose RPS configuration changed
+ * @cpu_map_list: RPS CPU mask of each rx queue
+ * @num_queues: number of entries in @cpu_map_list, 0 to disable steering
+ *
+ * Queue 0 carries all unsteered traffic and is never picked. For each CPU
+ * the queue with the narrowest mask containing it is selected. RPS is
+ * enabled and disabled per interface, so the map is kept per adapter.
+ *
+ * Return: None
+ */
+static void hdd_rps_flow_update_rxq_map(struct hdd_adapter *adapter,
+					uint16_t *cpu_map_list,
+					uint8_t num_queues)
+{
+	uint8_t rxq_map[NUM_CPUS] = {0};
+	bool active = false;
+	uint8_t q, cur;
+	uint32_t cpu;
+
+	if (!adapter->hdd_ctx->config->rps_flow_steering)
+		num_queues = 0;
+
+	for (q = 1; q < num_queues; q++) {
+		for (cpu = 0; cpu < NUM_CPUS && cpu < 16; cpu++) {
+			if (!(cpu_map_list[q] & BIT(cpu)))
+				continue;
+			cur = rxq_map[cpu];
+			if (!cur || hweight16(cpu_map_list[q]) <
+				    hweight16(cpu_map_list[cur]))
+				rxq_map[cpu] = q;
+			active = true;
+		}
+	}
+
+	qdf_mem_copy(adapter->rps_cpu_rxq, rxq_map, sizeof(rxq_map));
+	adapter->rps_flow_steering = active;
+	hdd_debug("rps flow steering %s on %s",
+		  active ? "enabled" : "disabled", adapter->dev->name);
+}
+
+#ifdef WLAN_FEATURE_DP_BUS_BANDWIDTH
+/**
+ * hdd_tcp_ts_parse() - Get the flow key and timestamps of a TCP segment
+ * @skb: frame, data pointing at the ethernet header
+ * @tsval: TSval of the segment
+ * @tsecr: TSecr of the segment
+ *
+ * Return: flow key, 0 if the frame is not a TCP segment with timestamps
+ */
+static uint32_t hdd_tcp_ts_parse(struct sk_buff *skb, uint32_t *tsval,
+				 uint32_t *tsecr)
+{
+	struct tcphdr *th;
+	uint8_t *opt;
+	__be32 ts[2];
+	uint32_t key, l4_off, opt_len, i;
+	uint8_t proto;
+
+	key = hdd_flow_key_parse(skb, &l4_off, &proto);
+	if (!key || proto != IPPROTO_TCP)
+		return 0;
+
+	if (skb_headlen(skb) < l4_off + sizeof(*th))
+		return 0;
+
+	th = (struct tcphdr *)(skb->data + l4_off);
+	opt_len = th->doff * 4;
+	if (opt_len < sizeof(*th) + TCPOLEN_TIMESTAMP ||
+	    skb_headlen(skb) < l4_off + opt_len)
+		return 0;
+
+	opt = (uint8_t *)(th + 1);
+	opt_len -= sizeof(*th);
+	for (i = 0; i < opt_len; ) {
+		if (opt[i] == TCPOPT_EOL)
+			return 0;
+		if (opt[i] == TCPOPT_NOP) {
+			i++;
+			continue;
+		}
+		if (i + 1 >= opt_len || opt[i + 1] < 2)
+			return 0;
+		if (opt[i] == TCPOPT_TIMESTAMP) {
+			if (opt[i + 1] != TCPOLEN_TIMESTAMP ||
+			    i + TCPOLEN_TIMESTAMP > opt_len)
+				return 0;
+			qdf_mem_copy(ts, &opt[i + 2], sizeof(ts));
+			*tsval = ntohl(ts[0]);
+			*tsecr = ntohl(ts[1]);
+			return key;
+		}
+		i += opt[i + 1];
+	}
+
+	return 0;
+}
+
+/**
+ * hdd_tcp_rtt_probe_arm() - Record the TSval sent by a local TCP flow
+ * @adapter: adapter the frame is transmitted on
+ * @skb: tx frame
+ *
+ * One probe per slot is outstanding at a time, so the tx path only writes
+ * a slot once per RTT of the flow it holds.
+ *
+ * Return: None
+ */
+static void hdd_tcp_rtt_probe_arm(struct hdd_adapter *adapter,
+				  struct sk_buff *skb)
+{
+	struct hdd_tcp_rtt_probe *probe;
+	uint32_t key, tsval, tsecr;
+	uint64_t now;
+
+	if (!adapter->hdd_ctx->config->tcp_rx_adaptive_tuning || !skb->sk)
+		return;
+
+	key = hdd_tcp_ts_parse(skb, &tsval, &tsecr);
+	if (!key)
+		return;
+
+	probe = &adapter->tcp_rtt_probe[key &
+					(HDD_TCP_RTT_PROBE_TBL_SIZE - 1)];
+	now = qdf_get_log_timestamp_usecs();
+	if (probe->key &&
+	    now - probe->sent_us < HDD_TCP_RTT_PROBE_AGE_MS * 1000)
+		return;
+
+	probe->tsval = tsval;
+	probe->sent_us = now;
+	probe->key = key;
+}
+
+/**
+ * hdd_tcp_rtt_sample() - Take an RTT sample from the TSecr of a segment
+ * @adapter: adapter the frame is received on
+ * @skb: rx frame, data pointing at the ethernet header
+ *
+ * The peer echoes the TSval of the probed segment once it has been acked,
+ * which gives the RTT of the flow without knowing the timestamp offset of
+ * the local socket. Samples are smoothed the same way the TCP stack does,
+ * with srtt kept scaled by 8.
+ *
+ * Return: None
+ */
+static void hdd_tcp_rtt_sample(struct hdd_adapter *adapter,
+			       struct sk_buff *skb)
+{
+	struct hdd_tcp_rx_tune *tune = &adapter->hdd_ctx->tcp_rx_tune;
+	struct hdd_tcp_rtt_probe *probe;
+	uint32_t key, tsval, tsecr, srtt;
+	uint64_t rtt_us;
+
+	key = hdd_tcp_ts_parse(skb, &tsval, &tsecr);
+	if (!key)
+		return;
+
+	probe = &adapter->tcp_rtt_probe[key &
+					(HDD_TCP_RTT_PROBE_TBL_SIZE - 1)];
+	if (probe->key != key || probe->tsval != tsecr)
+		return;
+
+	rtt_us = qdf_get_log_timestamp_usecs() - probe->sent_us;
+	probe->key = 0;
+	if (rtt_us >= HDD_TCP_RTT_PROBE_AGE_MS * 1000)
+		return;
+
+	srtt = tune->srtt_us;
+	if (!srtt)
+		srtt = rtt_us << 3;
+	else
+		srtt = srtt - (srtt >> 3) + rtt_us;
+
+	tune->srtt_us = srtt ? srtt : 1;
+	tune->rtt_samples++;
+}
+#else
+static inline void hdd_tcp_rtt_probe_arm(struct hdd_adapter *adapter,
+					 struct sk_buff *skb)
+{
+}
+
+static inline void hdd_tcp_rtt_sample(struct hdd_adapter *adapter,
+				      struct sk_buff *skb)
+{
+}
+#endif /* WLAN_FEATURE_DP_BUS_BANDWIDTH */
+
+#ifdef WLAN_DP_LATENCY_DEBUGFS
+/**
+ * hdd_dp_lat_begin() - Decide whether to time a data path event
+ * @hdd_ctx: HDD context
+ *
+ * Return: start time in usecs if the event is sampled, 0 otherwise
+ */
+static inline uint64_t hdd_dp_lat_begin(struct hdd_context *hdd_ctx)
+{
+	uint32_t rate = hdd_ctx->dp_lat_sample_rate;
+	struct hdd_dp_lat_cpu *lat;
+
+	if (qdf_likely(!rate))
+		return 0;
+
+	lat = &hdd_ctx->dp_lat[wlan_hdd_get_cpu()];
+	if (++lat->seq & (rate - 1))
+		return 0;
+
+	return qdf_get_log_timestamp_usecs();
+}
+
+/**
+ * hdd_dp_lat_record() - Add a latency sample to the histogram of a stage
+ * @hdd_ctx: HDD context
+ * @stage: data path stage
+ * @start_us: start time of the sample in usecs
+ *
+ * Return: None
+ */
+static void hdd_dp_lat_record(struct hdd_context *hdd_ctx,
+			      enum hdd_dp_lat_stage stage, uint64_t start_us)
+{
+	struct hdd_dp_lat_hist *hist;
+	uint64_t lat_us;
+	uint32_t bin;
+
+	lat_us = qdf_get_log_timestamp_usecs() - start_us;
+	if (lat_us > HDD_DP_LAT_MAX_US)
+		return;
+
+	bin = qdf_min(fls((uint32_t)lat_us), HDD_DP_LAT_NUM_BINS - 1);
+	hist = &hdd_ctx->dp_lat[wlan_hdd_get_cpu()].hist[stage];
+	hist->bin[bin]++;
+	hist->count++;
+	hist->sum_us += lat_us;
+	if (lat_us > hist->max_us)
+		hist->max_us = lat_us;
+}
+
+/**
+ * hdd_dp_lat_tx_slot() - Get the completion slot of a tx frame
+ * @hdd_ctx: HDD context
+ * @skb: tx frame
+ *
+ * Return: completion slot
+ */
+static inline struct hdd_dp_lat_tx_slot *
+hdd_dp_lat_tx_slot(struct hdd_context *hdd_ctx, struct sk_buff *skb)
+{
+	return &hdd_ctx->dp_lat_tx[hash_ptr(skb,
+					    ilog2(HDD_DP_LAT_TX_SLOTS))];
+}
+
+/**
+ * hdd_dp_lat_tx_arm() - Time a sampled tx frame up to its completion
+ * @hdd_ctx: HDD context
+ * @skb: tx frame
+ * @start_us: xmit entry time of the frame in usecs
+ *
+ * The frame asks for a completion notification, the same way tracked ARP,
+ * EAPOL and DHCP frames do.
+ *
+ * Return: None
+ */
+static void hdd_dp_lat_tx_arm(struct hdd_context *hdd_ctx,
+			      struct sk_buff *skb, uint64_t start_us)
+{
+	struct hdd_dp_lat_tx_slot *slot = hdd_dp_lat_tx_slot(hdd_ctx, skb);
+
+	slot->start_us = start_us;
+	slot->nbuf = skb;
+	QDF_NBUF_CB_TX_EXTRA_FRAG_FLAGS_NOTIFY_COMP(skb) = 1;
+}
+
+/**
+ * hdd_dp_lat_tx_disarm() - Forget a sampled tx frame that was dropped
+ * @hdd_ctx: HDD context
+ * @skb: tx frame
+ *
+ * Return: None
+ */
+static void hdd_dp_lat_tx_disarm(struct hdd_context *hdd_ctx,
+				 struct sk_buff *skb)
+{
+	struct hdd_dp_lat_tx_slot *slot = hdd_dp_lat_tx_slot(hdd_ctx, skb);
+
+	if (slot->nbuf == skb)
+		slot->nbuf = NULL;
+}
+
+/**
+ * hdd_dp_lat_tx_comp() - Take the completion sample of a tx frame
+ * @hdd_ctx: HDD context
+ * @skb: completed tx frame
+ *
+ * Return: None
+ */
+static void hdd_dp_lat_tx_comp(struct hdd_context *hdd_ctx,
+			       struct sk_buff *skb)
+{
+	struct hdd_dp_lat_tx_slot *slot = hdd_dp_lat_tx_slot(hdd_ctx, skb);
+	uint64_t start_us;
+
+	if (slot->nbuf != skb)
+		return;
+
+	start_us = slot->start_us;
+	slot->nbuf = NULL;
+	hdd_dp_lat_record(hdd_ctx, HDD_DP_LAT_TX_COMP, start_us);
+}
+#else
+static inline uint64_t hdd_dp_lat_begin(struct hdd_context *hdd_ctx)
+{
+	return 0;
+}
+
+static inline void hdd_dp_lat_record(struct hdd_context *hdd_ctx,
+				     enum hdd_dp_lat_stage stage,
+				     uint64_t start_us)
+{
+}
+
+static inline void hdd_dp_lat_tx_arm(struct hdd_context *hdd_ctx,
+				     struct sk_buff *skb, uint64_t start_us)
+{
+}
+
+static inline void hdd_dp_lat_tx_disarm(struct hdd_context *hdd_ctx,
+					struct sk_buff *skb)
+{
+}
+
+static inline void hdd_dp_lat_tx_comp(struct hdd_context *hdd_ctx,
+				      struct sk_buff *skb)
+{
+}
+#endif /* WLAN_DP_LATENCY_DEBUGFS */
+
 /**
  * __hdd_hard_start_xmit() - Transmit a frame
  * @skb: pointer to OS packet (sk_buff)
@@ -1031,12 +1558,12 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 	struct qdf_mac_addr mac_addr_tx_allowed = QDF_MAC_ADDR_ZERO_INIT;
 	uint8_t pkt_type = 0;
 	bool is_arp = false;
-	struct wlan_objmgr_vdev *vdev;
 	struct hdd_context *hdd_ctx;
 	void *soc = cds_get_context(QDF_MODULE_ID_SOC);
 	enum qdf_proto_subtype subtype = QDF_PROTO_INVALID;
 	bool is_eapol = false;
 	bool is_dhcp = false;
+	uint64_t lat_start = 0;
 
 #ifdef QCA_WIFI_FTM
 	if (hdd_get_conparam() == QDF_GLOBAL_FTM_MODE) {
@@ -1065,6 +1592,8 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 		goto drop_pkt;
 	}
 
+	lat_start = hdd_dp_lat_begin(hdd_ctx);
+
 	wlan_hdd_classify_pkt(skb);
 	if (QDF_NBUF_CB_GET_PACKET_TYPE(skb) == QDF_NBUF_CB_PACKET_TYPE_ARP) {
 		if (qdf_nbuf_data_is_arp_req(skb) &&
@@ -1123,6 +1652,9 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 	/* Get TL AC corresponding to Qdisc queue index/AC. */
 	ac = hdd_qdisc_ac_to_tl_ac[skb->queue_mapping];
 
+	hdd_rps_flow_learn(adapter, skb);
+	hdd_tcp_rtt_probe_arm(adapter, skb);
+
 	if (!qdf_nbuf_ipa_owned_get(skb)) {
 		skb = hdd_skb_orphan(adapter, skb);
 		if (!skb)
@@ -1213,11 +1745,7 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 
 	adapter->stats.tx_bytes += skb->len;
 
-	vdev = hdd_objmgr_get_vdev_by_user(adapter, WLAN_OSIF_TDLS_ID);
-	if (vdev) {
-		ucfg_tdls_update_tx_pkt_cnt(vdev, &mac_addr);
-		hdd_objmgr_put_vdev_by_user(vdev, WLAN_OSIF_TDLS_ID);
-	}
+	hdd_tdls_ct_count(adapter, wlan_hdd_get_cpu(), &mac_addr, true);
 
 	if (qdf_nbuf_is_tso(skb)) {
 		adapter->stats.tx_packets += qdf_nbuf_get_tso_num_seg(skb);
@@ -1271,15 +1799,23 @@ static void __hdd_hard_start_xmit(struct sk_buff *skb,
 
 	wlan_hdd_fix_broadcast_eapol(adapter, skb);
 
+	if (qdf_unlikely(lat_start))
+		hdd_dp_lat_tx_arm(hdd_ctx, skb, lat_start);
+
 	if (adapter->tx_fn(soc, adapter->vdev_id, (qdf_nbuf_t)skb)) {
 		QDF_TRACE(QDF_MODULE_ID_HDD_DATA, QDF_TRACE_LEVEL_INFO_HIGH,
 			  "%s: Failed to send packet to txrx for sta_id: "
 			  QDF_MAC_ADDR_FMT,
 			  __func__, QDF_MAC_ADDR_REF(mac_addr.bytes));
 		++adapter->hdd_stats.tx_rx_stats.tx_dropped_ac[ac];
+		if (qdf_unlikely(lat_start))
+			hdd_dp_lat_tx_disarm(hdd_ctx, skb);
 		goto drop_pkt_and_release_skb;
 	}
 
+	if (qdf_unlikely(lat_start))
+		hdd_dp_lat_record(hdd_ctx, HDD_DP_LAT_TX_DP, lat_start);
+
 	netif_trans_update(dev);
 
 	wlan_hdd_sar_unsolicited_timer_start(hdd_ctx);
@@ -1498,6 +2034,7 @@ QDF_STATUS hdd_mon_rx_packet_cbk(void *context, qdf_nbuf_t rxbuf)
 	struct sk_buff *skb;
 	struct sk_buff *skb_next;
 	unsigned int cpu_index;
+	struct hdd_rx_cpu_stats *rx_stats;
 
 	/* Sanity check on inputs */
 	if ((!context) || (!rxbuf)) {
@@ -1514,6 +2051,7 @@ QDF_STATUS hdd_mon_rx_packet_cbk(void *context, qdf_nbuf_t rxbuf)
 	}
 
 	cpu_index = wlan_hdd_get_cpu();
+	rx_stats = &adapter->hdd_stats.tx_rx_stats.rx_cpu[cpu_index];
 
 	/* walk the chain until all are processed */
 	skb = (struct sk_buff *) rxbuf;
@@ -1521,7 +2059,7 @@ QDF_STATUS hdd_mon_rx_packet_cbk(void *context, qdf_nbuf_t rxbuf)
 		skb_next = skb->next;
 		skb->dev = adapter->dev;
 
-		++adapter->hdd_stats.tx_rx_stats.rx_packets[cpu_index];
+		++rx_stats->rx_packets;
 		++adapter->stats.rx_packets;
 		adapter->stats.rx_bytes += skb->len;
 
@@ -1545,10 +2083,9 @@ QDF_STATUS hdd_mon_rx_packet_cbk(void *context, qdf_nbuf_t rxbuf)
 		}
 
 		if (NET_RX_SUCCESS == rxstat)
-			++adapter->
-				hdd_stats.tx_rx_stats.rx_delivered[cpu_index];
+			++rx_stats->rx_delivered;
 		else
-			++adapter->hdd_stats.tx_rx_stats.rx_refused[cpu_index];
+			++rx_stats->rx_refused;
 
 		skb = skb_next;
 	}
@@ -1557,6 +2094,127 @@ QDF_STATUS hdd_mon_rx_packet_cbk(void *context, qdf_nbuf_t rxbuf)
 }
 #endif
 
+/*
+ * Rx packet class bits. hdd_rx_classify() parses the L2/L3/L4 headers of a
+ * frame once and the per-frame checks in hdd_rx_packet_cbk() consume the
+ * resulting class word instead of re-parsing the headers each time.
+ */
+#define HDD_RX_CLASS_GROUP	BIT(0)
+#define HDD_RX_CLASS_IPV4	BIT(1)
+#define HDD_RX_CLASS_IPV6	BIT(2)
+#define HDD_RX_CLASS_TCP	BIT(3)
+#define HDD_RX_CLASS_UDP	BIT(4)
+#define HDD_RX_CLASS_ICMP	BIT(5)
+#define HDD_RX_CLASS_ICMPV6	BIT(6)
+#define HDD_RX_CLASS_ARP	BIT(7)
+#define HDD_RX_CLASS_EAPOL	BIT(8)
+#define HDD_RX_CLASS_DHCP	BIT(9)
+
+/* Frames that need the ARP/EAPOL/DHCP bookkeeping */
+#define HDD_RX_CLASS_CTRL \
+	(HDD_RX_CLASS_ARP | HDD_RX_CLASS_EAPOL | HDD_RX_CLASS_DHCP)
+
+#define HDD_RX_DHCP_SRV_PORT	67
+#define HDD_RX_DHCP_CLI_PORT	68
+
+/**
+ * hdd_rx_classify_l4() - classify the transport header of an IP frame
+ * @proto: IP protocol / IPv6 next header
+ *
+ * Return: class bits for the transport layer
+ */
+static uint16_t hdd_rx_classify_l4(uint8_t proto)
+{
+	switch (proto) {
+	case IPPROTO_TCP:
+		return HDD_RX_CLASS_TCP;
+	case IPPROTO_UDP:
+		return HDD_RX_CLASS_UDP;
+	case IPPROTO_ICMP:
+		return HDD_RX_CLASS_ICMP;
+	case IPPROTO_ICMPV6:
+		return HDD_RX_CLASS_ICMPV6;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * hdd_rx_is_dhcp() - check the UDP ports of an IPv4 frame for DHCP
+ * @skb: rx frame, data pointing at the ethernet header
+ * @l4_off: offset of the UDP header from skb->data, 0 if absent
+ *
+ * Only used for IPv4 frames, qdf_nbuf_get_dhcp_subtype() expects an IPv4
+ * header in front of the DHCP payload.
+ *
+ * Return: true if the frame is a DHCP frame
+ */
+static bool hdd_rx_is_dhcp(struct sk_buff *skb, uint32_t l4_off)
+{
+	struct udphdr *udph;
+
+	if (!l4_off || skb->len < l4_off + sizeof(*udph))
+		return false;
+
+	udph = (struct udphdr *)(skb->data + l4_off);
+
+	return (udph->source == htons(HDD_RX_DHCP_SRV_PORT) &&
+		udph->dest == htons(HDD_RX_DHCP_CLI_PORT)) ||
+	       (udph->source == htons(HDD_RX_DHCP_CLI_PORT) &&
+		udph->dest == htons(HDD_RX_DHCP_SRV_PORT));
+}
+
+/**
+ * hdd_rx_classify() - parse an rx frame once into a class word
+ * @skb: rx frame, data pointing at the ethernet header
+ *
+ * Plain TCP/UDP data resolves after reading the ethertype and the IP
+ * protocol (plus the UDP ports), so the common case stays cheap.
+ *
+ * Return: HDD_RX_CLASS_* bits describing the frame
+ */
+static uint16_t hdd_rx_classify(struct sk_buff *skb)
+{
+	struct ethhdr *eth;
+	struct iphdr *iph;
+	struct ipv6hdr *ip6h;
+	uint16_t cls = 0;
+	uint32_t l4_off;
+
+	if (qdf_unlikely(skb->len < ETH_HLEN))
+		return 0;
+
+	eth = (struct ethhdr *)skb->data;
+	if (is_multicast_ether_addr(eth->h_dest))
+		cls |= HDD_RX_CLASS_GROUP;
+
+	switch (eth->h_proto) {
+	case htons(ETH_P_IP):
+		if (skb->len < ETH_HLEN + sizeof(*iph))
+			return cls | HDD_RX_CLASS_IPV4;
+		iph = (struct iphdr *)(skb->data + ETH_HLEN);
+		/* only the first fragment carries the transport header */
+		l4_off = (iph->frag_off & htons(IP_OFFSET)) ?
+			 0 : ETH_HLEN + iph->ihl * 4;
+		cls |= HDD_RX_CLASS_IPV4 | hdd_rx_classify_l4(iph->protocol);
+		if ((cls & HDD_RX_CLASS_UDP) && hdd_rx_is_dhcp(skb, l4_off))
+			cls |= HDD_RX_CLASS_DHCP;
+		return cls;
+	case htons(ETH_P_IPV6):
+		if (skb->len < ETH_HLEN + sizeof(*ip6h))
+			return cls | HDD_RX_CLASS_IPV6;
+		ip6h = (struct ipv6hdr *)(skb->data + ETH_HLEN);
+		return cls | HDD_RX_CLASS_IPV6 |
+		       hdd_rx_classify_l4(ip6h->nexthdr);
+	case htons(ETH_P_ARP):
+		return cls | HDD_RX_CLASS_ARP;
+	case htons(ETH_P_PAE):
+		return cls | HDD_RX_CLASS_EAPOL;
+	default:
+		return cls;
+	}
+}
+
 /*
  * hdd_is_mcast_replay() - checks if pkt is multicast replay
  * @skb: packet skb
@@ -1627,6 +2285,7 @@ static bool hdd_is_arp_local(struct sk_buff *skb)
 /**
  * hdd_is_rx_wake_lock_needed() - check if wake lock is needed
  * @skb: pointer to sk_buff
+ * @rx_class: class word of the frame, from hdd_rx_classify()
  *
  * RX wake lock is needed for:
  * 1) Unicast data packet OR
@@ -1634,15 +2293,28 @@ static bool hdd_is_arp_local(struct sk_buff *skb)
  *
  * Return: true if wake lock is needed or false otherwise.
  */
-static bool hdd_is_rx_wake_lock_needed(struct sk_buff *skb)
+static bool hdd_is_rx_wake_lock_needed(struct sk_buff *skb, uint16_t rx_class)
 {
 	if ((skb->pkt_type != PACKET_BROADCAST &&
-	     skb->pkt_type != PACKET_MULTICAST) || hdd_is_arp_local(skb))
+	     skb->pkt_type != PACKET_MULTICAST) ||
+	    ((rx_class & HDD_RX_CLASS_ARP) && hdd_is_arp_local(skb)))
 		return true;
 
 	return false;
 }
 
+/**
+ * hdd_rx_cpu_stats() - Get the rx counters of the adapter for this CPU
+ * @adapter: adapter receiving the frame
+ *
+ * Return: rx counters owned by the current CPU
+ */
+static inline struct hdd_rx_cpu_stats *
+hdd_rx_cpu_stats(struct hdd_adapter *adapter)
+{
+	return &adapter->hdd_stats.tx_rx_stats.rx_cpu[wlan_hdd_get_cpu()];
+}
+
 #ifdef RECEIVE_OFFLOAD
 /**
  * hdd_resolve_rx_ol_mode() - Resolve Rx offload method, LRO or GRO
@@ -1720,8 +2392,7 @@ static QDF_STATUS hdd_gro_rx_bh_disable(struct hdd_adapter *adapter,
 	if (hdd_get_current_throughput_level(hdd_ctx) == PLD_BUS_WIDTH_IDLE ||
 	    !rx_aggregation || adapter->gro_disallowed[rx_ctx_id]) {
 		if (HDD_IS_EXTRA_GRO_FLUSH_NECESSARY(gro_ret)) {
-			adapter->hdd_stats.tx_rx_stats.
-					rx_gro_low_tput_flush++;
+			hdd_rx_cpu_stats(adapter)->rx_gro_low_tput_flush++;
 			dp_rx_napi_gro_flush(napi_to_use,
 					     DP_RX_GRO_NORMAL_FLUSH);
 		}
@@ -1768,7 +2439,7 @@ static QDF_STATUS hdd_gro_rx_bh_disable(struct hdd_adapter *adapter,
 
 	if (hdd_get_current_throughput_level(hdd_ctx) == PLD_BUS_WIDTH_IDLE) {
 		if (HDD_IS_EXTRA_GRO_FLUSH_NECESSARY(gro_ret)) {
-			adapter->hdd_stats.tx_rx_stats.rx_gro_low_tput_flush++;
+			hdd_rx_cpu_stats(adapter)->rx_gro_low_tput_flush++;
 			dp_rx_napi_gro_flush(napi_to_use,
 					     DP_RX_GRO_NORMAL_FLUSH);
 		}
@@ -2118,7 +2789,7 @@ QDF_STATUS hdd_rx_thread_gro_flush_ind_cbk(void *adapter, int rx_ctx_id)
 		return QDF_STATUS_SUCCESS;
 
 	if (hdd_is_low_tput_gro_enable(hdd_adapter->hdd_ctx)) {
-		hdd_adapter->hdd_stats.tx_rx_stats.rx_gro_flush_skip++;
+		hdd_rx_cpu_stats(hdd_adapter)->rx_gro_flush_skip++;
 		gro_flush_code = DP_RX_GRO_LOW_TPUT_FLUSH;
 	}
 
@@ -2164,7 +2835,7 @@ QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
 	int status = QDF_STATUS_E_FAILURE;
 	int netif_status;
 
-	adapter->hdd_stats.tx_rx_stats.rx_non_aggregated++;
+	hdd_rx_cpu_stats(adapter)->rx_non_aggregated++;
 	hdd_ctx->no_rx_offload_pkt_cnt++;
 	netif_status = netif_rx_ni(skb);
 
@@ -2293,12 +2964,12 @@ QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
 		status = hdd_ctx->receive_offload_cb(adapter, skb);
 
 		if (QDF_IS_STATUS_SUCCESS(status)) {
-			adapter->hdd_stats.tx_rx_stats.rx_aggregated++;
+			hdd_rx_cpu_stats(adapter)->rx_aggregated++;
 			return status;
 		}
 
 		if (status == QDF_STATUS_E_GRO_DROP) {
-			adapter->hdd_stats.tx_rx_stats.rx_gro_dropped++;
+			hdd_rx_cpu_stats(adapter)->rx_gro_dropped++;
 			return status;
 		}
 	}
@@ -2312,7 +2983,7 @@ QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
 	    hdd_ctx->dp_agg_param.gro_force_flush[rx_ctx_id])
 		hdd_ctx->dp_agg_param.gro_force_flush[rx_ctx_id] = 0;
 
-	adapter->hdd_stats.tx_rx_stats.rx_non_aggregated++;
+	hdd_rx_cpu_stats(adapter)->rx_non_aggregated++;
 
 	/* Account for GRO/LRO ineligible packets, mostly UDP */
 	if (qdf_nbuf_get_gso_segs(skb) == 0)
@@ -2343,6 +3014,27 @@ QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
 	return status;
 }
 
+/**
+ * hdd_rx_batch_prepare() - per frame checks of hdd_rx_deliver_to_stack()
+ * for a frame delivered without GRO/LRO
+ * @adapter: pointer to HDD adapter context
+ * @skb: rx frame
+ *
+ * Return: None
+ */
+static inline void
+hdd_rx_batch_prepare(struct hdd_adapter *adapter, struct sk_buff *skb)
+{
+	struct hdd_context *hdd_ctx = adapter->hdd_ctx;
+	uint8_t rx_ctx_id = QDF_NBUF_CB_RX_CTX_ID(skb);
+
+	hdd_rx_check_qdisc_for_adapter(adapter, rx_ctx_id);
+
+	if (qdf_atomic_read(&hdd_ctx->dp_agg_param.rx_aggregation) &&
+	    hdd_ctx->dp_agg_param.gro_force_flush[rx_ctx_id])
+		hdd_ctx->dp_agg_param.gro_force_flush[rx_ctx_id] = 0;
+}
+
 #else /* WLAN_FEATURE_DYNAMIC_RX_AGGREGATION */
 
 QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
@@ -2361,17 +3053,17 @@ QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
 		status = hdd_ctx->receive_offload_cb(adapter, skb);
 
 		if (QDF_IS_STATUS_SUCCESS(status)) {
-			adapter->hdd_stats.tx_rx_stats.rx_aggregated++;
+			hdd_rx_cpu_stats(adapter)->rx_aggregated++;
 			return status;
 		}
 
 		if (status == QDF_STATUS_E_GRO_DROP) {
-			adapter->hdd_stats.tx_rx_stats.rx_gro_dropped++;
+			hdd_rx_cpu_stats(adapter)->rx_gro_dropped++;
 			return status;
 		}
 	}
 
-	adapter->hdd_stats.tx_rx_stats.rx_non_aggregated++;
+	hdd_rx_cpu_stats(adapter)->rx_non_aggregated++;
 
 	/* Account for GRO/LRO ineligible packets, mostly UDP */
 	if (qdf_nbuf_get_gso_segs(skb) == 0)
@@ -2401,7 +3093,60 @@ QDF_STATUS hdd_rx_deliver_to_stack(struct hdd_adapter *adapter,
 
 	return status;
 }
+
+static inline void
+hdd_rx_batch_prepare(struct hdd_adapter *adapter, struct sk_buff *skb)
+{
+}
 #endif /* WLAN_FEATURE_DYNAMIC_RX_AGGREGATION */
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(4, 19, 0))
+bool hdd_rx_batch_add(struct hdd_adapter *adapter, struct hdd_rx_batch *batch,
+		      struct sk_buff *skb)
+{
+	if (qdf_unlikely(QDF_NBUF_CB_RX_PEER_CACHED_FRM(skb)))
+		return false;
+
+	hdd_rx_batch_prepare(adapter, skb);
+
+	/* Account for GRO/LRO ineligible packets, mostly UDP */
+	if (qdf_nbuf_get_gso_segs(skb) == 0)
+		adapter->hdd_ctx->no_rx_offload_pkt_cnt++;
+
+	list_add_tail(&skb->list, &batch->list);
+	batch->count++;
+
+	return true;
+}
+
+void hdd_rx_deliver_to_stack_list(struct hdd_adapter *adapter,
+				  struct hdd_rx_batch *batch,
+				  unsigned int cpu_index)
+{
+	struct hdd_context *hdd_ctx = adapter->hdd_ctx;
+	struct hdd_rx_cpu_stats *rx_stats;
+
+	if (!batch->count)
+		return;
+
+	rx_stats = &adapter->hdd_stats.tx_rx_stats.rx_cpu[cpu_index];
+	rx_stats->rx_non_aggregated += batch->count;
+
+	if (qdf_likely((hdd_ctx->enable_dp_rx_threads ||
+			hdd_ctx->enable_rxthread) &&
+		       !adapter->runtime_disable_rx_thread)) {
+		local_bh_disable();
+		netif_receive_skb_list(&batch->list);
+		local_bh_enable();
+	} else { /* NAPI Context */
+		netif_receive_skb_list(&batch->list);
+	}
+
+	/* list rx reports no per frame status, drops show in netdev stats */
+	rx_stats->rx_delivered += batch->count;
+	hdd_rx_batch_init(batch);
+}
+#endif
 #endif
 
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(4, 6, 0))
@@ -2476,14 +3221,20 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 	struct sk_buff *next = NULL;
 	struct hdd_station_ctx *sta_ctx = NULL;
 	unsigned int cpu_index;
-	struct qdf_mac_addr *mac_addr, *dest_mac_addr;
+	struct hdd_rx_cpu_stats *rx_stats;
+	struct qdf_mac_addr *mac_addr;
 	bool wake_lock = false;
 	uint8_t pkt_type = 0;
 	bool track_arp = false;
-	struct wlan_objmgr_vdev *vdev;
 	enum qdf_proto_subtype subtype = QDF_PROTO_INVALID;
 	bool is_eapol;
 	bool is_dhcp;
+	uint16_t rx_class;
+	struct hdd_rx_batch rx_batch;
+	uint32_t rx_frames = 0;
+	uint32_t rx_pkts = 0;
+	uint32_t rx_bytes = 0;
+	uint64_t lat_start, stack_start = 0;
 
 	/* Sanity check on inputs */
 	if (unlikely((!adapter_context) || (!rxBuf))) {
@@ -2508,6 +3259,9 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 	}
 
 	cpu_index = wlan_hdd_get_cpu();
+	rx_stats = &adapter->hdd_stats.tx_rx_stats.rx_cpu[cpu_index];
+	hdd_rx_batch_init(&rx_batch);
+	lat_start = hdd_dp_lat_begin(hdd_ctx);
 
 	next = (struct sk_buff *)rxBuf;
 
@@ -2517,8 +3271,17 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 		skb->next = NULL;
 		is_eapol = false;
 		is_dhcp = false;
+		rx_class = hdd_rx_classify(skb);
+
+		if (adapter->rps_flow_steering &&
+		    (rx_class & (HDD_RX_CLASS_TCP | HDD_RX_CLASS_UDP)))
+			hdd_rps_flow_steer(adapter, skb);
 
-		if (qdf_nbuf_is_ipv4_arp_pkt(skb)) {
+		if (HDD_MSM_CFG(hdd_ctx->config->tcp_rx_adaptive_tuning) &&
+		    (rx_class & HDD_RX_CLASS_TCP))
+			hdd_tcp_rtt_sample(adapter, skb);
+
+		if (rx_class & HDD_RX_CLASS_ARP) {
 			if (qdf_nbuf_data_is_arp_rsp(skb) &&
 				(adapter->track_arp_ip ==
 			     qdf_nbuf_get_arp_src_ip(skb))) {
@@ -2530,7 +3293,7 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 						__func__);
 				track_arp = true;
 			}
-		} else if (qdf_nbuf_is_ipv4_eapol_pkt(skb)) {
+		} else if (rx_class & HDD_RX_CLASS_EAPOL) {
 			subtype = qdf_nbuf_get_eapol_subtype(skb);
 			if (subtype == QDF_PROTO_EAPOL_M1) {
 				++adapter->hdd_stats.hdd_eapol_stats.
@@ -2541,7 +3304,7 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 						eapol_m3_count;
 				is_eapol = true;
 			}
-		} else if (qdf_nbuf_is_ipv4_dhcp_pkt(skb)) {
+		} else if (rx_class & HDD_RX_CLASS_DHCP) {
 			subtype = qdf_nbuf_get_dhcp_subtype(skb);
 			if (subtype == QDF_PROTO_DHCP_OFFER) {
 				++adapter->hdd_stats.hdd_dhcp_stats.
@@ -2553,16 +3316,17 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 				is_dhcp = true;
 			}
 		}
-		/* track connectivity stats */
-		if (adapter->pkt_type_bitmap)
+		/* track connectivity stats, all tracked types are IPv4 */
+		if (adapter->pkt_type_bitmap &&
+		    (rx_class & HDD_RX_CLASS_IPV4))
 			hdd_tx_rx_collect_connectivity_stats_info(skb, adapter,
 						PKT_TYPE_RSP, &pkt_type);
 
 		sta_ctx = WLAN_HDD_GET_STATION_CTX_PTR(adapter);
 		if ((sta_ctx->conn_info.proxy_arp_service) &&
+		    (rx_class & (HDD_RX_CLASS_ARP | HDD_RX_CLASS_ICMPV6)) &&
 		    hdd_is_gratuitous_arp_unsolicited_na(skb)) {
-			qdf_atomic_inc(&adapter->hdd_stats.tx_rx_stats.
-						rx_usolict_arp_n_mcast_drp);
+			++rx_stats->rx_usolict_arp_n_mcast_drp;
 			/* Remove SKB from internal tracking table before
 			 * submitting it to stack.
 			 */
@@ -2570,7 +3334,8 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 			continue;
 		}
 
-		hdd_event_eapol_log(skb, QDF_RX);
+		if (rx_class & HDD_RX_CLASS_EAPOL)
+			hdd_event_eapol_log(skb, QDF_RX);
 		qdf_dp_trace_log_pkt(adapter->vdev_id, skb, QDF_RX,
 				     QDF_TRACE_DEFAULT_PDEV_ID);
 
@@ -2584,34 +3349,26 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 			QDF_DP_TRACE_RX_PACKET_RECORD,
 			0, QDF_RX));
 
-		dest_mac_addr = (struct qdf_mac_addr *)(skb->data);
 		mac_addr = (struct qdf_mac_addr *)(skb->data+QDF_MAC_ADDR_SIZE);
 
-		vdev = hdd_objmgr_get_vdev_by_user(adapter,
-						   WLAN_OSIF_TDLS_ID);
-		if (vdev) {
-			ucfg_tdls_update_rx_pkt_cnt(vdev, mac_addr,
-						    dest_mac_addr);
-			hdd_objmgr_put_vdev_by_user(vdev,
-						    WLAN_OSIF_TDLS_ID);
-		}
+		if (!(rx_class & HDD_RX_CLASS_GROUP))
+			hdd_tdls_ct_count(adapter, cpu_index, mac_addr, false);
 
 		skb->dev = adapter->dev;
 		skb->protocol = eth_type_trans(skb, skb->dev);
-		++adapter->hdd_stats.tx_rx_stats.rx_packets[cpu_index];
-		++adapter->stats.rx_packets;
+		rx_frames++;
 		/* count aggregated RX frame into stats */
-		adapter->stats.rx_packets += qdf_nbuf_get_gso_segs(skb);
-		adapter->stats.rx_bytes += skb->len;
+		rx_pkts += 1 + qdf_nbuf_get_gso_segs(skb);
+		rx_bytes += skb->len;
 
 		/* Incr GW Rx count for NUD tracking based on GW mac addr */
 		hdd_nud_incr_gw_rx_pkt_cnt(adapter, mac_addr);
 
 		/* Check & drop replayed mcast packets (for IPV6) */
 		if (hdd_ctx->config->multicast_replay_filter &&
-				hdd_is_mcast_replay(skb)) {
-			qdf_atomic_inc(&adapter->hdd_stats.tx_rx_stats.
-						rx_usolict_arp_n_mcast_drp);
+		    (rx_class & HDD_RX_CLASS_GROUP) &&
+		    hdd_is_mcast_replay(skb)) {
+			++rx_stats->rx_usolict_arp_n_mcast_drp;
 			qdf_nbuf_free(skb);
 			continue;
 		}
@@ -2620,7 +3377,7 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 		if (!hdd_is_current_high_throughput(hdd_ctx) &&
 		    hdd_ctx->config->rx_wakelock_timeout &&
 		    sta_ctx->conn_info.is_authenticated)
-			wake_lock = hdd_is_rx_wake_lock_needed(skb);
+			wake_lock = hdd_is_rx_wake_lock_needed(skb, rx_class);
 
 		if (wake_lock) {
 			cds_host_diag_log_work(&hdd_ctx->rx_wake_lock,
@@ -2638,11 +3395,30 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 
 		hdd_tsf_timestamp_rx(hdd_ctx, skb, ktime_to_us(skb->tstamp));
 
+		/*
+		 * GRO ineligible data frames that need no per frame delivery
+		 * status are collected and go to the stack as one list. The
+		 * list is flushed before any frame is delivered on its own,
+		 * so the stack sees the frames in chain order.
+		 */
+		if (!(rx_class & (HDD_RX_CLASS_CTRL | HDD_RX_CLASS_TCP)) &&
+		    !adapter->pkt_type_bitmap &&
+		    hdd_rx_batch_add(adapter, &rx_batch, skb))
+			continue;
+
+		hdd_rx_deliver_to_stack_list(adapter, &rx_batch, cpu_index);
+
+		if (qdf_unlikely(lat_start))
+			stack_start = qdf_get_log_timestamp_usecs();
+
 		qdf_status = hdd_rx_deliver_to_stack(adapter, skb);
 
+		if (qdf_unlikely(lat_start))
+			hdd_dp_lat_record(hdd_ctx, HDD_DP_LAT_RX_STACK,
+					  stack_start);
+
 		if (QDF_IS_STATUS_SUCCESS(qdf_status)) {
-			++adapter->hdd_stats.tx_rx_stats.
-						rx_delivered[cpu_index];
+			++rx_stats->rx_delivered;
 			if (track_arp)
 				++adapter->hdd_stats.hdd_arp_stats.
 							rx_delivered;
@@ -2654,12 +3430,13 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 				rx_delivered[subtype - QDF_PROTO_DHCP_DISCOVER];
 
 			/* track connectivity stats */
-			if (adapter->pkt_type_bitmap)
+			if (adapter->pkt_type_bitmap &&
+			    (rx_class & HDD_RX_CLASS_IPV4))
 				hdd_tx_rx_collect_connectivity_stats_info(
 					skb, adapter,
 					PKT_TYPE_RX_DELIVERED, &pkt_type);
 		} else {
-			++adapter->hdd_stats.tx_rx_stats.rx_refused[cpu_index];
+			++rx_stats->rx_refused;
 			if (track_arp)
 				++adapter->hdd_stats.hdd_arp_stats.rx_refused;
 
@@ -2671,13 +3448,24 @@ QDF_STATUS hdd_rx_packet_cbk(void *adapter_context,
 				  rx_refused[subtype - QDF_PROTO_DHCP_DISCOVER];
 
 			/* track connectivity stats */
-			if (adapter->pkt_type_bitmap)
+			if (adapter->pkt_type_bitmap &&
+			    (rx_class & HDD_RX_CLASS_IPV4))
 				hdd_tx_rx_collect_connectivity_stats_info(
 					skb, adapter,
 					PKT_TYPE_RX_REFUSED, &pkt_type);
 		}
 	}
 
+	hdd_rx_deliver_to_stack_list(adapter, &rx_batch, cpu_index);
+
+	if (qdf_unlikely(lat_start))
+		hdd_dp_lat_record(hdd_ctx, HDD_DP_LAT_RX_CHAIN, lat_start);
+
+	rx_stats->rx_packets += rx_frames;
+	adapter->stats.rx_packets += rx_pkts;
+	adapter->stats.rx_bytes += rx_bytes;
+	hdd_bus_bw_check_rx_backlog(hdd_ctx, rx_frames);
+
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -2744,12 +3532,14 @@ const char *hdd_action_type_to_string(enum netif_action_type action)
 
 /**
  * wlan_hdd_update_queue_oper_stats - update queue operation statistics
- * @adapter: adapter handle
+ * @cpu_hist: netif queue log of the current CPU
  * @action: action type
  * @reason: reason type
  */
-static void wlan_hdd_update_queue_oper_stats(struct hdd_adapter *adapter,
-	enum netif_action_type action, enum netif_reason_type reason)
+static void
+wlan_hdd_update_queue_oper_stats(struct hdd_netif_queue_cpu_history *cpu_hist,
+				 enum netif_action_type action,
+				 enum netif_reason_type reason)
 {
 	switch (action) {
 	case WLAN_STOP_ALL_NETIF_QUEUE:
@@ -2759,7 +3549,7 @@ static void wlan_hdd_update_queue_oper_stats(struct hdd_adapter *adapter,
 	case WLAN_NETIF_VO_QUEUE_OFF:
 	case WLAN_NETIF_PRIORITY_QUEUE_OFF:
 	case WLAN_STOP_NON_PRIORITY_QUEUE:
-		adapter->queue_oper_stats[reason].pause_count++;
+		cpu_hist->pause_count[reason]++;
 		break;
 	case WLAN_START_ALL_NETIF_QUEUE:
 	case WLAN_WAKE_ALL_NETIF_QUEUE:
@@ -2768,7 +3558,7 @@ static void wlan_hdd_update_queue_oper_stats(struct hdd_adapter *adapter,
 	case WLAN_NETIF_VO_QUEUE_ON:
 	case WLAN_NETIF_PRIORITY_QUEUE_ON:
 	case WLAN_WAKE_NON_PRIORITY_QUEUE:
-		adapter->queue_oper_stats[reason].unpause_count++;
+		cpu_hist->unpause_count[reason]++;
 		break;
 	default:
 		break;
@@ -2846,25 +3636,72 @@ static void wlan_hdd_update_unpause_time(struct hdd_adapter *adapter)
  *
  * Return: none
  */
-static void wlan_hdd_update_pause_time(struct hdd_adapter *adapter,
-	 uint32_t temp_map)
+static void wlan_hdd_update_pause_time(struct hdd_adapter *adapter)
 {
 	qdf_time_t curr_time = qdf_system_ticks();
-	uint8_t i;
-	qdf_time_t pause_time;
 
-	pause_time = curr_time - adapter->last_time;
-	adapter->total_pause_time += pause_time;
+	adapter->total_pause_time += curr_time - adapter->last_time;
 	adapter->last_time = curr_time;
+}
 
-	for (i = 0; i < WLAN_REASON_TYPE_MAX; i++) {
-		if (temp_map & (1 << i)) {
-			adapter->queue_oper_stats[i].total_pause_time +=
-								 pause_time;
-			break;
-		}
+/**
+ * wlan_hdd_pause_reason_set() - Mark the netif queues paused by a reason
+ * @adapter: adapter handle
+ * @reason: reason type
+ *
+ * Caller must hold pause_map_lock.
+ *
+ * Return: none
+ */
+static void wlan_hdd_pause_reason_set(struct hdd_adapter *adapter,
+				      enum netif_reason_type reason)
+{
+	if (!(adapter->pause_map & (1 << reason)))
+		adapter->reason_pause_start[reason] = qdf_system_ticks();
+
+	adapter->pause_map |= (1 << reason);
+}
+
+/**
+ * wlan_hdd_pause_reason_clear() - Release the netif queue pause of a reason
+ * @adapter: adapter handle
+ * @reason: reason type
+ *
+ * Accounts the time the reason kept the queues paused. Caller must hold
+ * pause_map_lock.
+ *
+ * Return: none
+ */
+static void wlan_hdd_pause_reason_clear(struct hdd_adapter *adapter,
+					enum netif_reason_type reason)
+{
+	if (adapter->pause_map & (1 << reason))
+		adapter->reason_pause_time[reason] +=
+			qdf_system_ticks() - adapter->reason_pause_start[reason];
+
+	adapter->pause_map &= ~(1 << reason);
+}
+
+void wlan_hdd_get_netif_queue_stats(struct hdd_adapter *adapter,
+				    enum netif_reason_type reason,
+				    struct hdd_netif_queue_stats *stats)
+{
+	struct hdd_netif_queue_cpu_history *cpu_hist;
+	int cpu;
+
+	qdf_mem_zero(stats, sizeof(*stats));
+	for (cpu = 0; cpu < NUM_CPUS; cpu++) {
+		cpu_hist = &adapter->queue_oper_history[cpu];
+		stats->pause_count += cpu_hist->pause_count[reason];
+		stats->unpause_count += cpu_hist->unpause_count[reason];
 	}
 
+	spin_lock_bh(&adapter->pause_map_lock);
+	stats->total_pause_time = adapter->reason_pause_time[reason];
+	if (adapter->pause_map & (1 << reason))
+		stats->total_pause_time +=
+			qdf_system_ticks() - adapter->reason_pause_start[reason];
+	spin_unlock_bh(&adapter->pause_map_lock);
 }
 
 uint32_t
@@ -2908,6 +3745,42 @@ wlan_hdd_update_queue_history_state(struct net_device *dev,
 	}
 }
 
+/**
+ * wlan_hdd_record_queue_history() - Log a netif queue operation
+ * @adapter: adapter handle
+ * @action: action type
+ * @reason: reason type
+ *
+ * The operation is logged into the ring of the current CPU. Queue control
+ * runs in both process and softirq context, so bottom halves are disabled
+ * while the log is written. That keeps the task on its CPU and keeps the
+ * softirq path of the same CPU out, with no shared lock taken.
+ *
+ * Return: None
+ */
+static void wlan_hdd_record_queue_history(struct hdd_adapter *adapter,
+					  enum netif_action_type action,
+					  enum netif_reason_type reason)
+{
+	struct hdd_netif_queue_cpu_history *cpu_hist;
+	struct hdd_netif_queue_history *q_hist;
+	uint32_t index;
+
+	local_bh_disable();
+	cpu_hist = &adapter->queue_oper_history[wlan_hdd_get_cpu()];
+	wlan_hdd_update_queue_oper_stats(cpu_hist, action, reason);
+
+	index = qdf_atomic_inc_return(&cpu_hist->index) - 1;
+	q_hist = &cpu_hist->entry[index & (WLAN_HDD_MAX_HISTORY_ENTRY - 1)];
+
+	q_hist->time = qdf_system_ticks();
+	q_hist->netif_action = action;
+	q_hist->netif_reason = reason;
+	q_hist->pause_map = adapter->pause_map;
+	wlan_hdd_update_queue_history_state(adapter->dev, q_hist);
+	local_bh_enable();
+}
+
 /**
  * wlan_hdd_stop_non_priority_queue() - stop non prority queues
  * @adapter: adapter handle
@@ -2951,10 +3824,6 @@ static inline void wlan_hdd_wake_non_priority_queue(struct hdd_adapter *adapter)
 void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 	enum netif_action_type action, enum netif_reason_type reason)
 {
-	uint32_t temp_map;
-	uint8_t index;
-	struct hdd_netif_queue_history *txq_hist_ptr;
-
 	if ((!adapter) || (WLAN_HDD_ADAPTER_MAGIC != adapter->magic) ||
 		 (!adapter->dev)) {
 		hdd_err("adapter is invalid");
@@ -2978,7 +3847,7 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 			wlan_hdd_update_txq_timestamp(adapter->dev);
 			wlan_hdd_update_unpause_time(adapter);
 		}
-		adapter->pause_map |= (1 << reason);
+		wlan_hdd_pause_reason_set(adapter, reason);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
@@ -2989,16 +3858,15 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 			wlan_hdd_update_txq_timestamp(adapter->dev);
 			wlan_hdd_update_unpause_time(adapter);
 		}
-		adapter->pause_map |= (1 << reason);
+		wlan_hdd_pause_reason_set(adapter, reason);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
 	case WLAN_NETIF_PRIORITY_QUEUE_ON:
 		spin_lock_bh(&adapter->pause_map_lock);
-		temp_map = adapter->pause_map;
-		adapter->pause_map &= ~(1 << reason);
+		wlan_hdd_pause_reason_clear(adapter, reason);
 		netif_wake_subqueue(adapter->dev, HDD_LINUX_AC_HI_PRIO);
-		wlan_hdd_update_pause_time(adapter, temp_map);
+		wlan_hdd_update_pause_time(adapter);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
@@ -3007,7 +3875,7 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 		netif_stop_subqueue(adapter->dev, HDD_LINUX_AC_HI_PRIO);
 		wlan_hdd_update_txq_timestamp(adapter->dev);
 		wlan_hdd_update_unpause_time(adapter);
-		adapter->pause_map |= (1 << reason);
+		wlan_hdd_pause_reason_set(adapter, reason);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
@@ -3017,7 +3885,7 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 		netif_stop_subqueue(adapter->dev, HDD_LINUX_AC_BE);
 		wlan_hdd_update_txq_timestamp(adapter->dev);
 		wlan_hdd_update_unpause_time(adapter);
-		adapter->pause_map |= (1 << reason);
+		wlan_hdd_pause_reason_set(adapter, reason);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
@@ -3026,16 +3894,15 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 		netif_stop_subqueue(adapter->dev, HDD_LINUX_AC_VI);
 		wlan_hdd_update_txq_timestamp(adapter->dev);
 		wlan_hdd_update_unpause_time(adapter);
-		adapter->pause_map |= (1 << reason);
+		wlan_hdd_pause_reason_set(adapter, reason);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
 	case WLAN_NETIF_VI_QUEUE_ON:
 		spin_lock_bh(&adapter->pause_map_lock);
-		temp_map = adapter->pause_map;
-		adapter->pause_map &= ~(1 << reason);
+		wlan_hdd_pause_reason_clear(adapter, reason);
 		netif_wake_subqueue(adapter->dev, HDD_LINUX_AC_VI);
-		wlan_hdd_update_pause_time(adapter, temp_map);
+		wlan_hdd_update_pause_time(adapter);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
@@ -3044,48 +3911,44 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 		netif_stop_subqueue(adapter->dev, HDD_LINUX_AC_VO);
 		wlan_hdd_update_txq_timestamp(adapter->dev);
 		wlan_hdd_update_unpause_time(adapter);
-		adapter->pause_map |= (1 << reason);
+		wlan_hdd_pause_reason_set(adapter, reason);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
 	case WLAN_NETIF_VO_QUEUE_ON:
 		spin_lock_bh(&adapter->pause_map_lock);
-		temp_map = adapter->pause_map;
-		adapter->pause_map &= ~(1 << reason);
+		wlan_hdd_pause_reason_clear(adapter, reason);
 		netif_wake_subqueue(adapter->dev, HDD_LINUX_AC_VO);
-		wlan_hdd_update_pause_time(adapter, temp_map);
+		wlan_hdd_update_pause_time(adapter);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
 	case WLAN_START_ALL_NETIF_QUEUE:
 		spin_lock_bh(&adapter->pause_map_lock);
-		temp_map = adapter->pause_map;
-		adapter->pause_map &= ~(1 << reason);
+		wlan_hdd_pause_reason_clear(adapter, reason);
 		if (!adapter->pause_map) {
 			netif_tx_start_all_queues(adapter->dev);
-			wlan_hdd_update_pause_time(adapter, temp_map);
+			wlan_hdd_update_pause_time(adapter);
 		}
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
 	case WLAN_WAKE_ALL_NETIF_QUEUE:
 		spin_lock_bh(&adapter->pause_map_lock);
-		temp_map = adapter->pause_map;
-		adapter->pause_map &= ~(1 << reason);
+		wlan_hdd_pause_reason_clear(adapter, reason);
 		if (!adapter->pause_map) {
 			netif_tx_wake_all_queues(adapter->dev);
-			wlan_hdd_update_pause_time(adapter, temp_map);
+			wlan_hdd_update_pause_time(adapter);
 		}
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
 
 	case WLAN_WAKE_NON_PRIORITY_QUEUE:
 		spin_lock_bh(&adapter->pause_map_lock);
-		temp_map = adapter->pause_map;
-		adapter->pause_map &= ~(1 << reason);
+		wlan_hdd_pause_reason_clear(adapter, reason);
 		if (!adapter->pause_map) {
 			wlan_hdd_wake_non_priority_queue(adapter);
-			wlan_hdd_update_pause_time(adapter, temp_map);
+			wlan_hdd_update_pause_time(adapter);
 		}
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
@@ -3097,7 +3960,7 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 			wlan_hdd_update_txq_timestamp(adapter->dev);
 			wlan_hdd_update_unpause_time(adapter);
 		}
-		adapter->pause_map |= (1 << reason);
+		wlan_hdd_pause_reason_set(adapter, reason);
 		netif_carrier_off(adapter->dev);
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
@@ -3105,11 +3968,10 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 	case WLAN_START_ALL_NETIF_QUEUE_N_CARRIER:
 		spin_lock_bh(&adapter->pause_map_lock);
 		netif_carrier_on(adapter->dev);
-		temp_map = adapter->pause_map;
-		adapter->pause_map &= ~(1 << reason);
+		wlan_hdd_pause_reason_clear(adapter, reason);
 		if (!adapter->pause_map) {
 			netif_tx_start_all_queues(adapter->dev);
-			wlan_hdd_update_pause_time(adapter, temp_map);
+			wlan_hdd_update_pause_time(adapter);
 		}
 		spin_unlock_bh(&adapter->pause_map_lock);
 		break;
@@ -3121,25 +3983,23 @@ void wlan_hdd_netif_queue_control(struct hdd_adapter *adapter,
 		hdd_err("unsupported action %d", action);
 	}
 
-	spin_lock_bh(&adapter->pause_map_lock);
-	if (adapter->pause_map & (1 << WLAN_PEER_UNAUTHORISED))
-		wlan_hdd_process_peer_unauthorised_pause(adapter);
-
-	index = adapter->history_index++;
-	if (adapter->history_index == WLAN_HDD_MAX_HISTORY_ENTRY)
-		adapter->history_index = 0;
-	spin_unlock_bh(&adapter->pause_map_lock);
-
-	wlan_hdd_update_queue_oper_stats(adapter, action, reason);
-
-	adapter->queue_oper_history[index].time = qdf_system_ticks();
-	adapter->queue_oper_history[index].netif_action = action;
-	adapter->queue_oper_history[index].netif_reason = reason;
-	adapter->queue_oper_history[index].pause_map = adapter->pause_map;
+	/*
+	 * tx backlog hit the flow control watermark, do not wait for the
+	 * next bus bandwidth compute interval to raise the vote
+	 */
+	if (reason == WLAN_DATA_FLOW_CONTROL &&
+	    (action == WLAN_STOP_ALL_NETIF_QUEUE ||
+	     action == WLAN_STOP_NON_PRIORITY_QUEUE))
+		hdd_bus_bw_escalate(adapter->hdd_ctx);
 
-	txq_hist_ptr = &adapter->queue_oper_history[index];
+	if (adapter->pause_map & (1 << WLAN_PEER_UNAUTHORISED)) {
+		spin_lock_bh(&adapter->pause_map_lock);
+		if (adapter->pause_map & (1 << WLAN_PEER_UNAUTHORISED))
+			wlan_hdd_process_peer_unauthorised_pause(adapter);
+		spin_unlock_bh(&adapter->pause_map_lock);
+	}
 
-	wlan_hdd_update_queue_history_state(adapter->dev, txq_hist_ptr);
+	wlan_hdd_record_queue_history(adapter, action, reason);
 }
 
 void hdd_print_netdev_txq_status(struct net_device *dev)
@@ -3262,6 +4122,9 @@ void hdd_send_rps_ind(struct hdd_adapter *adapter)
 			  i, rps_data.cpu_map_list[i]);
 	}
 
+	hdd_rps_flow_update_rxq_map(adapter, rps_data.cpu_map_list,
+				    rps_data.num_queues);
+
 	strlcpy(rps_data.ifname, adapter->dev->name,
 			sizeof(rps_data.ifname));
 	wlan_hdd_send_svc_nlink_msg(hdd_ctxt->radio_index,
@@ -3307,6 +4170,7 @@ void hdd_send_rps_disable_ind(struct hdd_adapter *adapter)
 	hdd_info("Set cpu_map_list 0");
 
 	qdf_mem_zero(&rps_data.cpu_map_list, sizeof(rps_data.cpu_map_list));
+	hdd_rps_flow_update_rxq_map(adapter, rps_data.cpu_map_list, 0);
 
 	strlcpy(rps_data.ifname, adapter->dev->name, sizeof(rps_data.ifname));
 	wlan_hdd_send_svc_nlink_msg(hdd_ctxt->radio_index,
@@ -3391,6 +4255,9 @@ void hdd_reset_tcp_delack(struct hdd_context *hdd_ctx)
 	rx_tp_data.rx_tp_flags |= TCP_DEL_ACK_IND;
 	rx_tp_data.level = next_level;
 	hdd_ctx->rx_high_ind_cnt = 0;
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	hdd_ctx->tcp_rx_tune.delack_seg = 0;
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
 	wlan_hdd_update_tcp_rx_param(hdd_ctx, &rx_tp_data);
 }
 
@@ -3405,6 +4272,9 @@ void hdd_reset_tcp_adv_win_scale(struct hdd_context *hdd_ctx)
 	rx_tp_data.rx_tp_flags |= TCP_ADV_WIN_SCL;
 	rx_tp_data.level = next_level;
 	hdd_ctx->cur_rx_level = WLAN_SVC_TP_NONE;
+	qdf_spin_lock_bh(&hdd_ctx->bus_bw_lock);
+	hdd_ctx->tcp_rx_tune.win_scale = 0;
+	qdf_spin_unlock_bh(&hdd_ctx->bus_bw_lock);
 	wlan_hdd_update_tcp_rx_param(hdd_ctx, &rx_tp_data);
 }
 
@@ -3513,6 +4383,12 @@ static void hdd_ini_bus_bandwidth(struct hdd_config *config,
 		cfg_get(psoc, CFG_DP_BUS_LOW_BW_CNT_THRESHOLD);
 	config->enable_latency_crit_clients =
 		cfg_get(psoc, CFG_DP_BUS_HANDLE_LATENCY_CRITICAL_CLIENTS);
+	config->bus_bw_predictive_vote =
+		cfg_get(psoc, CFG_DP_BUS_BANDWIDTH_PREDICTIVE_VOTE);
+	config->bus_bw_down_hysteresis =
+		cfg_get(psoc, CFG_DP_BUS_BANDWIDTH_DOWN_HYSTERESIS);
+	config->bus_bw_escalate_threshold =
+		cfg_get(psoc, CFG_DP_BUS_BANDWIDTH_ESCALATE_THRESHOLD);
 }
 
 /**
@@ -3541,6 +4417,8 @@ static void hdd_ini_tcp_settings(struct hdd_config *config,
 		cfg_get(psoc, CFG_DP_TCP_TX_HIGH_TPUT_THRESHOLD);
 	config->enable_tcp_param_update =
 		cfg_get(psoc, CFG_DP_ENABLE_TCP_PARAM_UPDATE);
+	config->tcp_rx_adaptive_tuning =
+		cfg_get(psoc, CFG_DP_TCP_RX_ADAPTIVE_TUNING);
 }
 #else
 static void hdd_ini_bus_bandwidth(struct hdd_config *config,
@@ -3716,6 +4594,7 @@ void hdd_dp_cfg_update(struct wlan_objmgr_psoc *psoc,
 			      cfg_default(CFG_DP_RPS_RX_QUEUE_CPU_MAP_LIST),
 			      cfg_len);
 	}
+	config->rps_flow_steering = cfg_get(psoc, CFG_DP_RPS_FLOW_STEERING);
 	config->tx_orphan_enable = cfg_get(psoc, CFG_DP_TX_ORPHAN_ENABLE);
 	config->rx_mode = cfg_get(psoc, CFG_DP_RX_MODE);
 	hdd_set_rx_mode_value(hdd_ctx);
@@ -3760,6 +4639,8 @@ void hdd_sta_notify_tx_comp_cb(qdf_nbuf_t skb, void *ctx, uint16_t flag)
 	if (hdd_validate_adapter(adapter))
 		return;
 
+	hdd_dp_lat_tx_comp(adapter->hdd_ctx, skb);
+
 	switch (QDF_NBUF_CB_GET_PACKET_TYPE(skb)) {
 	case QDF_NBUF_CB_PACKET_TYPE_ARP:
 		if (flag & BIT(QDF_TX_RX_STATUS_DOWNLOAD_SUCC))
@@ -3023,18 +3023,12 @@ void hdd_wlan_get_stats(struct hdd_adapter *adapter, uint16_t *length,
 			char *buffer, uint16_t buf_len)
 {
 	struct hdd_tx_rx_stats *stats = &adapter->hdd_stats.tx_rx_stats;
+	struct hdd_rx_cpu_stats rx_stats, *cpu_stats;
 	uint32_t len = 0;
-	uint32_t total_rx_pkt = 0, total_rx_dropped = 0;
-	uint32_t total_rx_delv = 0, total_rx_refused = 0;
-	int i = 0;
+	int i;
 	struct hdd_context *hdd_ctx = adapter->hdd_ctx;
 
-	for (; i < NUM_CPUS; i++) {
-		total_rx_pkt += stats->rx_packets[i];
-		total_rx_dropped += stats->rx_dropped[i];
-		total_rx_delv += stats->rx_delivered[i];
-		total_rx_refused += stats->rx_refused[i];
-	}
+	hdd_get_rx_cpu_stats_sum(stats, &rx_stats);
 
 	len = scnprintf(buffer, buf_len,
 			"\nTransmit[%lu] - "
@@ -3057,24 +3051,25 @@ void hdd_wlan_get_stats(struct hdd_adapter *adapter, uint16_t *length,
 			stats->tx_classified_ac[SME_AC_VI],
 			stats->tx_classified_ac[SME_AC_VO],
 			qdf_system_ticks(),
-			total_rx_pkt, total_rx_dropped,
-			qdf_atomic_read(&stats->rx_usolict_arp_n_mcast_drp),
-			total_rx_delv,
-			total_rx_refused,
-			stats->rx_aggregated, stats->rx_non_aggregated,
-			stats->rx_gro_flush_skip,
-			stats->rx_gro_low_tput_flush,
+			rx_stats.rx_packets, rx_stats.rx_dropped,
+			rx_stats.rx_usolict_arp_n_mcast_drp,
+			rx_stats.rx_delivered,
+			rx_stats.rx_refused,
+			rx_stats.rx_aggregated, rx_stats.rx_non_aggregated,
+			rx_stats.rx_gro_flush_skip,
+			rx_stats.rx_gro_low_tput_flush,
 			qdf_atomic_read(&hdd_ctx->disable_rx_ol_in_concurrency),
 			qdf_atomic_read(&hdd_ctx->disable_rx_ol_in_low_tput));
 
 	for (i = 0; i < NUM_CPUS; i++) {
-		if (stats->rx_packets[i] == 0)
+		cpu_stats = &stats->rx_cpu[i];
+		if (cpu_stats->rx_packets == 0)
 			continue;
 		len += scnprintf(buffer + len, buf_len - len,
 				 "Rx CPU[%d]:"
 				 "packets %u, dropped %u, delivered %u, refused %u\n",
-				 i, stats->rx_packets[i], stats->rx_dropped[i],
-				 stats->rx_delivered[i], stats->rx_refused[i]);
+				 i, cpu_stats->rx_packets, cpu_stats->rx_dropped,
+				 cpu_stats->rx_delivered, cpu_stats->rx_refused);
 	}
 
 	len += scnprintf(buffer + len, buf_len - len,
@@ -108,6 +108,11 @@ static inline mac_handle_t MAC_HANDLE(struct mac_context *mac)
 #define PMF_INCORRECT_KEY 1
 #define PMF_CORRECT_KEY 0
 
+/* number of buckets of the PE session BSSID lookup table, power of 2 */
+#define PE_SESSION_BSSID_HASH_SIZE 16
+/* terminates the PE session lookup chains */
+#define PE_SESSION_INVALID_IDX 0xFF
+
 /**
  * enum log_event_type - Type of event initiating bug report
  * @WLAN_LOG_TYPE_NON_FATAL: Non fatal event
@@ -300,6 +305,29 @@ typedef struct {
 	void *pMlmDeauthReq;
 } tLimDisassocDeauthCnfReq;
 
+/* bits of the bloom filter on the first match data bytes, power of 2 */
+#define LIM_MGMT_FRM_BLOOM_BITS 256
+
+/**
+ * struct lim_mgmt_frm_matcher - summary of the registered mgmt frames
+ * @match_all_mgmt: a SIR_MAC_MGMT_RESERVED15 registration matches every
+ *	management frame
+ * @frm_type_mask: frame types (type << 4 | subtype) with a registration
+ * @short_match_mask: frame types with a registration of less than two
+ *	match data bytes, those are not represented in @bloom
+ * @bloom: bloom filter on frame type and the first two match data bytes
+ *
+ * Built from gLimMgmtFrameRegistratinQueue whenever it changes. It tells
+ * for sure when a received frame matches no registration, so that the
+ * queue is only walked for frames that may match.
+ */
+struct lim_mgmt_frm_matcher {
+	bool match_all_mgmt;
+	uint64_t frm_type_mask;
+	uint64_t short_match_mask;
+	uint32_t bloom[LIM_MGMT_FRM_BLOOM_BITS / 32];
+};
+
 typedef struct sAniSirLim {
 	/* ////////////////////////////////////     TIMER RELATED START /////////////////////////////////////////// */
 
@@ -631,10 +659,14 @@ typedef struct sAniSirLim {
 	/* wsc info required to form the wsc IE */
 	tLimWscIeInfo wscIeInfo;
 	struct pe_session *gpSession;  /* Pointer to  session table */
+	/* heads of the gpSession index chains, keyed by vdev id and BSSID */
+	uint8_t session_by_vdev[WLAN_MAX_VDEVS];
+	uint8_t session_by_bssid[PE_SESSION_BSSID_HASH_SIZE];
 	uint8_t max_sta_of_pe_session;
 
 	qdf_mutex_t lim_frame_register_lock;
 	qdf_list_t gLimMgmtFrameRegistratinQueue;
+	struct lim_mgmt_frm_matcher mgmt_frm_matcher;
 	uint32_t tdls_frm_session_id;
 
 	struct pe_session *pe_session;
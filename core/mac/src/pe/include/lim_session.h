@@ -158,6 +158,9 @@ struct pe_session {
 	tSirMacAddr self_mac_addr;
 	tSirMacSSid ssId;
 	uint8_t valid;
+	/* next gpSession index with the same vdev id / BSSID hash */
+	uint8_t next_by_vdev;
+	uint8_t next_by_bssid;
 	tLimMlmStates limMlmState;      /* MLM State */
 	tLimMlmStates limPrevMlmState;  /* Previous MLM State */
 	tLimSmeStates limSmeState;      /* SME State */
@@ -652,6 +655,28 @@ struct pe_session *pe_create_session(struct mac_context *mac,
 struct pe_session *pe_find_session_by_bssid(struct mac_context *mac, uint8_t *bssid,
 				     uint8_t *sessionId);
 
+/**
+ * pe_init_session_lookup() - empty the PE session lookup tables
+ * @mac: pointer to global adapter context
+ *
+ * Return: None
+ */
+void pe_init_session_lookup(struct mac_context *mac);
+
+/**
+ * pe_update_session_bssid() - change the BSSID of a PE session
+ * @mac: pointer to global adapter context
+ * @session: PE session
+ * @bssid: new BSSID of @session
+ *
+ * The BSSID of a valid PE session must only be changed through this API so
+ * that pe_find_session_by_bssid() keeps finding the session.
+ *
+ * Return: None
+ */
+void pe_update_session_bssid(struct mac_context *mac,
+			     struct pe_session *session, uint8_t *bssid);
+
 /**
  * pe_find_session_by_vdev_id() - looks up the PE session given the vdev_id.
  * @mac:             pointer to global adapter context
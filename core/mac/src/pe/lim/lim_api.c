@@ -466,6 +466,8 @@ void lim_cleanup(struct mac_context *mac)
 			&lst_node) == QDF_STATUS_SUCCESS) {
 		qdf_mem_free(lst_node);
 	}
+	qdf_mem_zero(&mac->lim.mgmt_frm_matcher,
+		     sizeof(mac->lim.mgmt_frm_matcher));
 	qdf_list_destroy(&mac->lim.gLimMgmtFrameRegistratinQueue);
 	qdf_mutex_destroy(&mac->lim.lim_frame_register_lock);
 
@@ -788,6 +790,8 @@ QDF_STATUS pe_open(struct mac_context *mac, struct cds_config_info *cds_cfg)
 {
 	QDF_STATUS status = QDF_STATUS_SUCCESS;
 
+	pe_init_session_lookup(mac);
+
 	if (QDF_DRIVER_TYPE_MFG == cds_cfg->driver_type)
 		return QDF_STATUS_SUCCESS;
 
@@ -1067,27 +1071,29 @@ static QDF_STATUS pe_drop_pending_rx_mgmt_frames(struct mac_context *mac_ctx,
  * is from Ext or EPNO scan
  *
  * @hdr: pointer to the 802.11 header of the frame
- * @rx_pkt_info: pointer to the rx packet meta
+ * @scan_src: scan source flags of the rx event
  *
- * Checks if the beacon or probe response is from Ext Scan or EPNO scan
+ * Checks if the beacon or probe response is from Ext Scan or EPNO scan.
+ * Only the low byte of @scan_src is looked at, as the rx packet meta
+ * keeps it in a uint8_t.
  *
  * Return: true or false
  */
 #ifdef FEATURE_WLAN_EXTSCAN
 static inline bool pe_is_ext_scan_bcn_probe_rsp(tpSirMacMgmtHdr hdr,
-				uint8_t *rx_pkt_info)
+						uint32_t scan_src)
 {
 	if ((hdr->fc.subType == SIR_MAC_MGMT_BEACON ||
 	     hdr->fc.subType == SIR_MAC_MGMT_PROBE_RSP) &&
-	    (WMA_IS_EXTSCAN_SCAN_SRC(rx_pkt_info) ||
-	    WMA_IS_EPNO_SCAN_SRC(rx_pkt_info)))
+	    ((uint8_t)scan_src == WMI_MGMT_RX_HDR_EXTSCAN ||
+	     ((uint8_t)scan_src & WMI_MGMT_RX_HDR_ENLO)))
 		return true;
 
 	return false;
 }
 #else
 static inline bool pe_is_ext_scan_bcn_probe_rsp(tpSirMacMgmtHdr hdr,
-				uint8_t *rx_pkt_info)
+						uint32_t scan_src)
 {
 	return false;
 }
@@ -1098,7 +1104,7 @@ static inline bool pe_is_ext_scan_bcn_probe_rsp(tpSirMacMgmtHdr hdr,
  *
  * @mac_ctx: pointer to the global mac context
  * @hdr: pointer to the 802.11 header of the frame
- * @rx_pkt_info: pointer to the rx packet meta
+ * @scan_src: scan source flags of the rx event
  *
  * Applies the filter from global mac context on the received beacon/
  * probe response frame before posting it to the PE queue
@@ -1107,12 +1113,12 @@ static inline bool pe_is_ext_scan_bcn_probe_rsp(tpSirMacMgmtHdr hdr,
  */
 static bool pe_filter_bcn_probe_frame(struct mac_context *mac_ctx,
 					tpSirMacMgmtHdr hdr,
-					uint8_t *rx_pkt_info)
+					uint32_t scan_src)
 {
 	uint8_t session_id;
 	struct mgmt_beacon_probe_filter *filter;
 
-	if (pe_is_ext_scan_bcn_probe_rsp(hdr, rx_pkt_info))
+	if (pe_is_ext_scan_bcn_probe_rsp(hdr, scan_src))
 		return true;
 
 	filter = &mac_ctx->bcn_filter;
@@ -1209,6 +1215,24 @@ static QDF_STATUS pe_handle_mgmt_frame(struct wlan_objmgr_psoc *psoc,
 		qdf_nbuf_free(buf);
 		return QDF_STATUS_SUCCESS;
 	}
+
+	/*
+	 * Filter the beacon/probe response frames on the raw 802.11 header,
+	 * before a cds packet is formed and posted on the PE queue for them.
+	 * Most of them are from BSSes PE has no session with, the scan
+	 * module gets its own copy of every frame from mgmt txrx.
+	 */
+	if (mgmt_rx_params->buf_len >= sizeof(*mHdr)) {
+		mHdr = (tpSirMacMgmtHdr)qdf_nbuf_data(buf);
+		if ((mHdr->fc.subType == SIR_MAC_MGMT_BEACON ||
+		     mHdr->fc.subType == SIR_MAC_MGMT_PROBE_RSP) &&
+		    !pe_filter_bcn_probe_frame(mac, mHdr,
+					       mgmt_rx_params->flags)) {
+			qdf_nbuf_free(buf);
+			return QDF_STATUS_SUCCESS;
+		}
+	}
+
 	pVosPkt = qdf_mem_malloc_atomic(sizeof(*pVosPkt));
 	if (!pVosPkt) {
 		qdf_nbuf_free(buf);
@@ -1237,18 +1261,6 @@ static QDF_STATUS pe_handle_mgmt_frame(struct wlan_objmgr_psoc *psoc,
 
 	mHdr = WMA_GET_RX_MAC_HEADER(pRxPacketInfo);
 
-	/*
-	 * Filter the beacon/probe response frames before posting it
-	 * on the PE queue
-	 */
-	if ((mHdr->fc.subType == SIR_MAC_MGMT_BEACON ||
-	    mHdr->fc.subType == SIR_MAC_MGMT_PROBE_RSP) &&
-	    !pe_filter_bcn_probe_frame(mac, mHdr, pRxPacketInfo)) {
-		cds_pkt_return_packet(pVosPkt);
-		pVosPkt = NULL;
-		return QDF_STATUS_SUCCESS;
-	}
-
 	/*
 	 * Post Probe Req frames to Scan queue and return
 	 */
@@ -1064,6 +1064,115 @@ static void lim_handle_unknown_a2_index_frames(struct mac_context *mac_ctx,
 	return;
 }
 
+/**
+ * lim_mgmt_frm_type_bit() - get the matcher bit of a frame type
+ * @type: frame type
+ * @sub_type: frame sub type
+ *
+ * Return: bit of the frame type in the lim_mgmt_frm_matcher masks
+ */
+static inline uint64_t lim_mgmt_frm_type_bit(uint8_t type, uint8_t sub_type)
+{
+	return (uint64_t)1 << (((type & 0x03) << 4) | (sub_type & 0x0f));
+}
+
+/**
+ * lim_mgmt_frm_bloom_hash() - get the bloom filter bits of a frame
+ * @frm_type: frame type in the gLimMgmtFrameRegistratinQueue encoding
+ * @data: first two bytes of the frame body or match data
+ * @hash: the two bloom filter bits are returned here
+ *
+ * Return: None
+ */
+static inline void lim_mgmt_frm_bloom_hash(uint16_t frm_type, uint8_t *data,
+					   uint32_t hash[2])
+{
+	uint32_t key = ((uint32_t)frm_type << 16) | (data[0] << 8) | data[1];
+
+	hash[0] = ((key * 0x9E3779B1) >> 24) % LIM_MGMT_FRM_BLOOM_BITS;
+	hash[1] = ((key * 0x85EBCA6B) >> 24) % LIM_MGMT_FRM_BLOOM_BITS;
+}
+
+void lim_build_mgmt_frm_matcher(struct mac_context *mac_ctx)
+{
+	struct lim_mgmt_frm_matcher *matcher = &mac_ctx->lim.mgmt_frm_matcher;
+	qdf_list_node_t *node = NULL, *next = NULL;
+	struct mgmt_frm_reg_info *reg;
+	uint8_t type, sub_type;
+	uint32_t hash[2];
+
+	qdf_mutex_acquire(&mac_ctx->lim.lim_frame_register_lock);
+	qdf_mem_zero(matcher, sizeof(*matcher));
+
+	qdf_list_peek_front(&mac_ctx->lim.gLimMgmtFrameRegistratinQueue,
+			    &node);
+	while (node) {
+		reg = (struct mgmt_frm_reg_info *)node;
+		type = (reg->frameType >> 2) & 0x03;
+		sub_type = (reg->frameType >> 4) & 0x0f;
+
+		if (type == SIR_MAC_MGMT_FRAME &&
+		    sub_type == SIR_MAC_MGMT_RESERVED15)
+			matcher->match_all_mgmt = true;
+
+		matcher->frm_type_mask |= lim_mgmt_frm_type_bit(type,
+								sub_type);
+		if (reg->matchLen < 2) {
+			matcher->short_match_mask |=
+				lim_mgmt_frm_type_bit(type, sub_type);
+		} else {
+			lim_mgmt_frm_bloom_hash(reg->frameType,
+						reg->matchData, hash);
+			matcher->bloom[hash[0] / 32] |= BIT(hash[0] % 32);
+			matcher->bloom[hash[1] / 32] |= BIT(hash[1] % 32);
+		}
+
+		qdf_list_peek_next(&mac_ctx->lim.gLimMgmtFrameRegistratinQueue,
+				   node, &next);
+		node = next;
+		next = NULL;
+	}
+	qdf_mutex_release(&mac_ctx->lim.lim_frame_register_lock);
+}
+
+/**
+ * lim_mgmt_frm_may_be_registered() - check the received frame against the
+ * registered mgmt frame matcher
+ * @mac_ctx: Pointer to the Global Mac Context.
+ * @fc: frame control of the received frame
+ * @body: frame body
+ * @frm_len: length of @body
+ *
+ * Return: false if the frame matches none of the registered frames, true if
+ * gLimMgmtFrameRegistratinQueue has to be walked to find the match
+ */
+static bool lim_mgmt_frm_may_be_registered(struct mac_context *mac_ctx,
+					   tSirMacFrameCtl fc, uint8_t *body,
+					   uint16_t frm_len)
+{
+	struct lim_mgmt_frm_matcher *matcher = &mac_ctx->lim.mgmt_frm_matcher;
+	uint64_t type_bit = lim_mgmt_frm_type_bit(fc.type, fc.subType);
+	uint16_t frm_type = (fc.type << 2) | (fc.subType << 4);
+	uint32_t hash[2];
+
+	if (matcher->match_all_mgmt && fc.type == SIR_MAC_MGMT_FRAME)
+		return true;
+
+	if (!(matcher->frm_type_mask & type_bit))
+		return false;
+
+	if (matcher->short_match_mask & type_bit)
+		return true;
+
+	if (frm_len < 2)
+		return false;
+
+	lim_mgmt_frm_bloom_hash(frm_type, body, hash);
+
+	return (matcher->bloom[hash[0] / 32] & BIT(hash[0] % 32)) &&
+	       (matcher->bloom[hash[1] / 32] & BIT(hash[1] % 32));
+}
+
 /**
  * lim_check_mgmt_registered_frames() - This function handles registered
  *                                      management frames.
@@ -1101,6 +1210,9 @@ lim_check_mgmt_registered_frames(struct mac_context *mac_ctx, uint8_t *buff_desc
 	action_hdr = (tpSirMacActionFrameHdr)body;
 	frm_len = WMA_GET_RX_PAYLOAD_LEN(buff_desc);
 
+	if (!lim_mgmt_frm_may_be_registered(mac_ctx, fc, body, frm_len))
+		return false;
+
 	qdf_mutex_acquire(&mac_ctx->lim.lim_frame_register_lock);
 	qdf_list_peek_front(&mac_ctx->lim.gLimMgmtFrameRegistratinQueue,
 			    (qdf_list_node_t **) &mgmt_frame);
@@ -7239,7 +7239,8 @@ skip_match:
 					&mac_ctx->lim.lim_frame_register_lock);
 		}
 	}
-	return;
+
+	lim_build_mgmt_frm_matcher(mac_ctx);
 }
 
 /**
@@ -60,8 +60,7 @@ void lim_update_re_assoc_globals(struct mac_context *mac, tpSirAssocRsp pAssocRs
 				 struct pe_session *pe_session)
 {
 	/* Update the current Bss Information */
-	qdf_mem_copy(pe_session->bssId,
-		     pe_session->limReAssocbssId, sizeof(tSirMacAddr));
+	pe_update_session_bssid(mac, pe_session, pe_session->limReAssocbssId);
 	pe_session->curr_op_freq = pe_session->lim_reassoc_chan_freq;
 	pe_session->htSecondaryChannelOffset =
 		pe_session->reAssocHtSupportedChannelWidthSet;
@@ -533,6 +533,141 @@ void lim_update_bcn_probe_filter(struct mac_context *mac_ctx,
 		 filter->num_sap_sessions);
 }
 
+/**
+ * pe_session_bssid_hash() - get the lookup table bucket of a BSSID
+ * @bssid: BSSID
+ *
+ * Return: index into mac->lim.session_by_bssid
+ */
+static inline uint8_t pe_session_bssid_hash(uint8_t *bssid)
+{
+	return (bssid[3] ^ bssid[4] ^ bssid[5]) &
+	       (PE_SESSION_BSSID_HASH_SIZE - 1);
+}
+
+/**
+ * pe_session_next() - get the link to the next session of a lookup chain
+ * @mac: pointer to global adapter context
+ * @idx: gpSession index of the current session
+ * @by_bssid: true for the BSSID chain, false for the vdev id chain
+ *
+ * Return: pointer to the next gpSession index of the chain
+ */
+static inline uint8_t *pe_session_next(struct mac_context *mac, uint8_t idx,
+				       bool by_bssid)
+{
+	return by_bssid ? &mac->lim.gpSession[idx].next_by_bssid :
+			  &mac->lim.gpSession[idx].next_by_vdev;
+}
+
+/**
+ * pe_session_unlink() - remove a session from a lookup chain
+ * @mac: pointer to global adapter context
+ * @head: head of the chain
+ * @idx: gpSession index of the session to remove
+ * @by_bssid: true for the BSSID chain, false for the vdev id chain
+ *
+ * Return: None
+ */
+static void pe_session_unlink(struct mac_context *mac, uint8_t *head,
+			      uint8_t idx, bool by_bssid)
+{
+	uint8_t *cur = head;
+
+	while (*cur != PE_SESSION_INVALID_IDX) {
+		if (*cur == idx) {
+			*cur = *pe_session_next(mac, idx, by_bssid);
+			*pe_session_next(mac, idx, by_bssid) =
+						PE_SESSION_INVALID_IDX;
+			return;
+		}
+		cur = pe_session_next(mac, *cur, by_bssid);
+	}
+}
+
+/**
+ * pe_session_link_bssid() - add a session to the BSSID lookup table
+ * @mac: pointer to global adapter context
+ * @session: PE session
+ *
+ * Return: None
+ */
+static void pe_session_link_bssid(struct mac_context *mac,
+				  struct pe_session *session)
+{
+	uint8_t *head = &mac->lim.session_by_bssid[
+				pe_session_bssid_hash(session->bssId)];
+
+	session->next_by_bssid = *head;
+	*head = session->peSessionId;
+}
+
+/**
+ * pe_session_link() - add a session to the lookup tables
+ * @mac: pointer to global adapter context
+ * @session: PE session
+ *
+ * Return: None
+ */
+static void pe_session_link(struct mac_context *mac,
+			    struct pe_session *session)
+{
+	session->next_by_vdev = PE_SESSION_INVALID_IDX;
+	if (session->vdev_id < WLAN_MAX_VDEVS) {
+		session->next_by_vdev =
+			mac->lim.session_by_vdev[session->vdev_id];
+		mac->lim.session_by_vdev[session->vdev_id] =
+			session->peSessionId;
+	}
+
+	pe_session_link_bssid(mac, session);
+}
+
+/**
+ * pe_session_unlink_all() - remove a session from the lookup tables
+ * @mac: pointer to global adapter context
+ * @session: PE session
+ *
+ * Return: None
+ */
+static void pe_session_unlink_all(struct mac_context *mac,
+				  struct pe_session *session)
+{
+	if (session->vdev_id < WLAN_MAX_VDEVS)
+		pe_session_unlink(mac,
+				  &mac->lim.session_by_vdev[session->vdev_id],
+				  session->peSessionId, false);
+
+	pe_session_unlink(mac,
+			  &mac->lim.session_by_bssid[
+				pe_session_bssid_hash(session->bssId)],
+			  session->peSessionId, true);
+}
+
+void pe_init_session_lookup(struct mac_context *mac)
+{
+	qdf_mem_set(mac->lim.session_by_vdev,
+		    sizeof(mac->lim.session_by_vdev), PE_SESSION_INVALID_IDX);
+	qdf_mem_set(mac->lim.session_by_bssid,
+		    sizeof(mac->lim.session_by_bssid), PE_SESSION_INVALID_IDX);
+}
+
+void pe_update_session_bssid(struct mac_context *mac,
+			     struct pe_session *session, uint8_t *bssid)
+{
+	if (!session->valid) {
+		sir_copy_mac_addr(session->bssId, bssid);
+		return;
+	}
+
+	pe_session_unlink(mac,
+			  &mac->lim.session_by_bssid[
+				pe_session_bssid_hash(session->bssId)],
+			  session->peSessionId, true);
+	sir_copy_mac_addr(session->bssId, bssid);
+	pe_session_link_bssid(mac, session);
+}
+
 struct pe_session *pe_create_session(struct mac_context *mac,
 				     uint8_t *bssid, uint8_t *sessionId,
 				     uint16_t numSta, enum bss_type bssType,
@@ -638,6 +773,7 @@ struct pe_session *pe_create_session(struct mac_context *mac,
 	session_ptr->vdev = vdev;
 	session_ptr->vdev_id = vdev_id;
 	session_ptr->mac_ctx = mac;
+	pe_session_link(mac, session_ptr);
 	session_ptr->opmode = wlan_vdev_mlme_get_opmode(vdev);
 	mlme_set_tdls_chan_switch_prohibited(vdev, false);
 	mlme_set_tdls_prohibited(vdev, false);
@@ -725,33 +861,46 @@ free_dp_hash_table:
 struct pe_session *pe_find_session_by_bssid(struct mac_context *mac, uint8_t *bssid,
 				     uint8_t *sessionId)
 {
-	uint8_t i;
+	uint8_t i, found = PE_SESSION_INVALID_IDX;
 
-	for (i = 0; i < mac->lim.maxBssId; i++) {
-		/* If BSSID matches return corresponding tables address */
-		if ((mac->lim.gpSession[i].valid)
-		    && (sir_compare_mac_addr(mac->lim.gpSession[i].bssId,
-					    bssid))) {
-			*sessionId = i;
-			return &mac->lim.gpSession[i];
-		}
+	/*
+	 * Walk the whole chain, the lowest session id wins if several
+	 * sessions share the BSSID, same as a scan of the session table.
+	 */
+	i = mac->lim.session_by_bssid[pe_session_bssid_hash(bssid)];
+	while (i != PE_SESSION_INVALID_IDX) {
+		if (i < found && mac->lim.gpSession[i].valid &&
+		    sir_compare_mac_addr(mac->lim.gpSession[i].bssId, bssid))
+			found = i;
+		i = mac->lim.gpSession[i].next_by_bssid;
 	}
 
-	return NULL;
+	if (found == PE_SESSION_INVALID_IDX)
+		return NULL;
 
+	*sessionId = found;
+	return &mac->lim.gpSession[found];
 }
 
 struct pe_session *pe_find_session_by_vdev_id(struct mac_context *mac,
 					      uint8_t vdev_id)
 {
-	uint8_t i;
+	uint8_t i, found = PE_SESSION_INVALID_IDX;
 
-	for (i = 0; i < mac->lim.maxBssId; i++) {
-		/* If BSSID matches return corresponding tables address */
-		if ((mac->lim.gpSession[i].valid) &&
-		    (mac->lim.gpSession[i].vdev_id == vdev_id))
-			return &mac->lim.gpSession[i];
+	if (vdev_id < WLAN_MAX_VDEVS)
+		i = mac->lim.session_by_vdev[vdev_id];
+	else
+		i = PE_SESSION_INVALID_IDX;
+
+	while (i != PE_SESSION_INVALID_IDX) {
+		if (i < found && mac->lim.gpSession[i].valid)
+			found = i;
+		i = mac->lim.gpSession[i].next_by_vdev;
 	}
+
+	if (found != PE_SESSION_INVALID_IDX)
+		return &mac->lim.gpSession[found];
+
 	pe_debug("Session lookup fails for vdev_id: %d", vdev_id);
 
 	return NULL;
@@ -762,14 +911,23 @@ struct pe_session
 				      uint8_t vdev_id,
 				      enum eLimMlmStates lim_state)
 {
-	uint8_t i;
+	uint8_t i, found = PE_SESSION_INVALID_IDX;
 
-	for (i = 0; i < mac->lim.maxBssId; i++) {
-		if (mac->lim.gpSession[i].valid &&
-		    mac->lim.gpSession[i].vdev_id == vdev_id &&
+	if (vdev_id < WLAN_MAX_VDEVS)
+		i = mac->lim.session_by_vdev[vdev_id];
+	else
+		i = PE_SESSION_INVALID_IDX;
+
+	while (i != PE_SESSION_INVALID_IDX) {
+		if (i < found && mac->lim.gpSession[i].valid &&
 		    mac->lim.gpSession[i].limMlmState == lim_state)
-			return &mac->lim.gpSession[i];
+			found = i;
+		i = mac->lim.gpSession[i].next_by_vdev;
 	}
+
+	if (found != PE_SESSION_INVALID_IDX)
+		return &mac->lim.gpSession[found];
+
 	pe_debug("Session lookup fails for vdev_id: %d, mlm state: %d",
 		 vdev_id, lim_state);
 
@@ -1001,6 +1159,7 @@ void pe_delete_session(struct mac_context *mac_ctx, struct pe_session *session)
 	}
 	pe_delete_fils_info(session);
 	lim_clear_pmfcomeback_timer(session);
+	pe_session_unlink_all(mac_ctx, session);
 	session->valid = false;
 
 	session->mac_ctx = NULL;
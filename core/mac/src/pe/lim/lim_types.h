@@ -364,6 +364,16 @@ void handle_ht_capabilityand_ht_info(struct mac_context *mac,
 
 void lim_handle_param_update(struct mac_context *mac, eUpdateIEsType cfgId);
 
+/**
+ * lim_build_mgmt_frm_matcher() - rebuild the registered mgmt frame matcher
+ * @mac_ctx: Pointer to Global MAC structure
+ *
+ * To be called whenever gLimMgmtFrameRegistratinQueue is changed.
+ *
+ * Return: None
+ */
+void lim_build_mgmt_frm_matcher(struct mac_context *mac_ctx);
+
 /* Function to apply CFG parameters before join/reassoc/start BSS */
 void lim_apply_configuration(struct mac_context *, struct pe_session *);
 
@@ -168,6 +168,14 @@ sapAcsChannelInfo acs_ht40_channels24_g[] = {
 /* rssi discount for channels in PCL */
 #define PCL_RSSI_DISCOUNT 10
 
+/* max age of the spectrum weights reused from a previous ACS run */
+#define SAP_ACS_CACHE_MAX_AGE_MS 30000
+
+/* inputs of the weight computation besides the scan results */
+#define SAP_ACS_CACHE_CH_VALID   BIT(0)
+#define SAP_ACS_CACHE_CH_IN_PCL  BIT(1)
+#define SAP_ACS_CACHE_CH_SCANNED BIT(2)
+
 #ifdef FEATURE_AP_MCC_CH_AVOIDANCE
 /**
  * sap_check_n_add_channel() - checks and add given channel in sap context's
@@ -1457,6 +1465,264 @@ debug_info:
 	sap_clear_channel_status(mac);
 }
 
+/**
+ * sap_acs_cache_ch_flags() - get the per channel inputs of the weight
+ * computation which do not come from the scan results
+ * @sap_ctx: Sap context
+ * @spect_ch: channel as initialized by sap_chan_sel_init()
+ *
+ * Return: SAP_ACS_CACHE_CH_* flags of @spect_ch
+ */
+static uint8_t sap_acs_cache_ch_flags(struct sap_context *sap_ctx,
+				      tSapSpectChInfo *spect_ch)
+{
+	uint8_t flags = 0;
+	uint32_t i;
+
+	if (spect_ch->valid)
+		flags |= SAP_ACS_CACHE_CH_VALID;
+
+	if (ch_in_pcl(sap_ctx, spect_ch->chan_freq))
+		flags |= SAP_ACS_CACHE_CH_IN_PCL;
+
+	for (i = 0; i < sap_ctx->num_of_channel; i++) {
+		if (spect_ch->chan_freq == sap_ctx->freq_list[i]) {
+			flags |= SAP_ACS_CACHE_CH_SCANNED;
+			break;
+		}
+	}
+
+	return flags;
+}
+
+/**
+ * sap_acs_cache_scan_stamp() - summarize the scan results for the cache
+ * @scan_list: scan entry list
+ * @num_entries: number of entries in @scan_list
+ * @newest_entry_time: scan_entry_time of the newest entry in @scan_list
+ *
+ * Return: None
+ */
+static void sap_acs_cache_scan_stamp(qdf_list_t *scan_list,
+				     uint32_t *num_entries,
+				     qdf_time_t *newest_entry_time)
+{
+	qdf_list_node_t *cur_lst = NULL, *next_lst = NULL;
+	struct scan_cache_node *cur_node;
+
+	*num_entries = 0;
+	*newest_entry_time = 0;
+
+	if (scan_list)
+		qdf_list_peek_front(scan_list, &cur_lst);
+	while (cur_lst) {
+		cur_node = qdf_container_of(cur_lst, struct scan_cache_node,
+					    node);
+		(*num_entries)++;
+		if (cur_node->entry->scan_entry_time > *newest_entry_time)
+			*newest_entry_time = cur_node->entry->scan_entry_time;
+
+		qdf_list_peek_next(scan_list, cur_lst, &next_lst);
+		cur_lst = next_lst;
+		next_lst = NULL;
+	}
+}
+
+/**
+ * sap_acs_has_channel_status() - check for channel status reported by fw
+ * @mac: Pointer to Global MAC structure
+ * @spect_info: spectrum as initialized by sap_chan_sel_init()
+ *
+ * The noise floor, free time and tx power of the channel status add to
+ * the weight of a channel but are not summarized by the cache key.
+ *
+ * Return: true if any channel of @spect_info has channel status
+ */
+static bool sap_acs_has_channel_status(struct mac_context *mac,
+				       tSapChSelSpectInfo *spect_info)
+{
+	struct lim_channel_status *channel_stat;
+	uint8_t i;
+
+	for (i = 0; i < spect_info->numSpectChans; i++) {
+		channel_stat = sap_get_channel_status(
+					mac, spect_info->pSpectCh[i].chan_freq);
+		if (channel_stat && channel_stat->channelfreq)
+			return true;
+	}
+
+	return false;
+}
+
+void sap_acs_cache_flush(struct sap_context *sap_ctx)
+{
+	struct sap_acs_spect_cache *cache = &sap_ctx->acs_spect_cache;
+
+	qdf_mem_free(cache->spect_ch);
+	qdf_mem_free(cache->ch_flags);
+	qdf_mem_zero(cache, sizeof(*cache));
+}
+
+/**
+ * sap_acs_cache_lookup() - reuse the cached spectrum weights
+ * @sap_ctx: Sap context
+ * @spect_info: spectrum as initialized by sap_chan_sel_init()
+ * @ch_flags: SAP_ACS_CACHE_CH_* flags of every channel in @spect_info
+ * @num_entries: number of scan entries the weights would be computed from
+ * @newest_entry_time: scan_entry_time of the newest of those entries
+ *
+ * The cached weights are reused only if no scan entry was added, aged out
+ * or refreshed since they were computed and none of the other inputs of
+ * the computation changed for any channel. A BSS also adds interference
+ * to its neighbour channels, so a single changed entry invalidates all of
+ * the weights rather than only those of its own channel.
+ *
+ * Return: true if @spect_info was filled from the cache
+ */
+static bool sap_acs_cache_lookup(struct sap_context *sap_ctx,
+				 tSapChSelSpectInfo *spect_info,
+				 uint8_t *ch_flags, uint32_t num_entries,
+				 qdf_time_t newest_entry_time)
+{
+	struct sap_acs_spect_cache *cache = &sap_ctx->acs_spect_cache;
+	qdf_time_t age;
+	uint8_t i;
+
+	if (!cache->spect_ch)
+		return false;
+
+	age = qdf_mc_timer_get_system_time() - cache->timestamp;
+	if (age > SAP_ACS_CACHE_MAX_AGE_MS) {
+		sap_debug("ACS cache expired, age %lu ms", age);
+		sap_acs_cache_flush(sap_ctx);
+		return false;
+	}
+
+	if (cache->num_ch != spect_info->numSpectChans ||
+	    cache->num_entries != num_entries ||
+	    cache->newest_entry_time != newest_entry_time)
+		return false;
+
+	for (i = 0; i < cache->num_ch; i++) {
+		if (cache->spect_ch[i].chan_freq !=
+		    spect_info->pSpectCh[i].chan_freq ||
+		    cache->ch_flags[i] != ch_flags[i])
+			return false;
+	}
+
+	qdf_mem_copy(spect_info->pSpectCh, cache->spect_ch,
+		     cache->num_ch * sizeof(*cache->spect_ch));
+	sap_debug("Reuse ACS weights of %u scan entries, age %lu ms",
+		  num_entries, age);
+
+	return true;
+}
+
+/**
+ * sap_acs_cache_store() - cache the computed spectrum weights
+ * @sap_ctx: Sap context
+ * @spect_info: spectrum with the computed weights
+ * @ch_flags: SAP_ACS_CACHE_CH_* flags of every channel in @spect_info
+ * @num_entries: number of scan entries the weights were computed from
+ * @newest_entry_time: scan_entry_time of the newest of those entries
+ *
+ * Return: None
+ */
+static void sap_acs_cache_store(struct sap_context *sap_ctx,
+				tSapChSelSpectInfo *spect_info,
+				uint8_t *ch_flags, uint32_t num_entries,
+				qdf_time_t newest_entry_time)
+{
+	struct sap_acs_spect_cache *cache = &sap_ctx->acs_spect_cache;
+	uint8_t num_ch = spect_info->numSpectChans;
+
+	if (cache->num_ch != num_ch) {
+		sap_acs_cache_flush(sap_ctx);
+		cache->spect_ch = qdf_mem_malloc(num_ch *
+						 sizeof(*cache->spect_ch));
+		cache->ch_flags = qdf_mem_malloc(num_ch *
+						 sizeof(*cache->ch_flags));
+		if (!cache->spect_ch || !cache->ch_flags) {
+			sap_acs_cache_flush(sap_ctx);
+			return;
+		}
+		cache->num_ch = num_ch;
+	}
+
+	qdf_mem_copy(cache->spect_ch, spect_info->pSpectCh,
+		     num_ch * sizeof(*cache->spect_ch));
+	qdf_mem_copy(cache->ch_flags, ch_flags,
+		     num_ch * sizeof(*cache->ch_flags));
+	cache->num_entries = num_entries;
+	cache->newest_entry_time = newest_entry_time;
+	cache->timestamp = qdf_mc_timer_get_system_time();
+}
+
+/**
+ * sap_compute_spect_weight_cached() - compute the weight of each channel
+ * in the spectrum or reuse the weights of the previous ACS run
+ * @spect_info: Pointer to the tSapChSelSpectInfo structure
+ * @mac_handle: Opaque handle to the global MAC context
+ * @scan_list: scan entry list
+ * @sap_ctx: Context of the SAP
+ *
+ * Repeated SAP starts, e.g. hotspot toggles, often run ACS again on the
+ * very same scan results. The weights of those are served from the cache
+ * of the previous run instead of being computed again. Channel status
+ * reported by the firmware is fresh for every run, so the cache is
+ * bypassed and dropped whenever there is any.
+ *
+ * Return: None
+ */
+static void sap_compute_spect_weight_cached(tSapChSelSpectInfo *spect_info,
+					    mac_handle_t mac_handle,
+					    qdf_list_t *scan_list,
+					    struct sap_context *sap_ctx)
+{
+	uint8_t *ch_flags;
+	uint32_t num_entries;
+	qdf_time_t newest_entry_time;
+	uint8_t i;
+
+	if (!spect_info->numSpectChans) {
+		sap_compute_spect_weight(spect_info, mac_handle, scan_list,
+					 sap_ctx);
+		return;
+	}
+
+	if (sap_acs_has_channel_status(MAC_CONTEXT(mac_handle), spect_info)) {
+		sap_acs_cache_flush(sap_ctx);
+		sap_compute_spect_weight(spect_info, mac_handle, scan_list,
+					 sap_ctx);
+		return;
+	}
+
+	ch_flags = qdf_mem_malloc(spect_info->numSpectChans *
+				  sizeof(*ch_flags));
+	if (!ch_flags) {
+		sap_compute_spect_weight(spect_info, mac_handle, scan_list,
+					 sap_ctx);
+		return;
+	}
+
+	for (i = 0; i < spect_info->numSpectChans; i++)
+		ch_flags[i] = sap_acs_cache_ch_flags(sap_ctx,
+						     &spect_info->pSpectCh[i]);
+	sap_acs_cache_scan_stamp(scan_list, &num_entries, &newest_entry_time);
+
+	if (sap_acs_cache_lookup(sap_ctx, spect_info, ch_flags, num_entries,
+				 newest_entry_time)) {
+		sap_clear_channel_status(MAC_CONTEXT(mac_handle));
+	} else {
+		sap_compute_spect_weight(spect_info, mac_handle, scan_list,
+					 sap_ctx);
+		sap_acs_cache_store(sap_ctx, spect_info, ch_flags, num_entries,
+				    newest_entry_time);
+	}
+
+	qdf_mem_free(ch_flags);
+}
+
 /*==========================================================================
    FUNCTION    sap_chan_sel_exit
 
@@ -1534,525 +1800,183 @@ static void sap_sort_chl_weight(tSapChSelSpectInfo *pSpectInfoParams)
 }
 
 /**
- * sap_sort_chl_weight_80_mhz() - to sort the channels with the least weight
- * @pSpectInfoParams: Pointer to the tSapChSelSpectInfo structure
- * Function to sort the channels with the least weight first for HT80 channels
+ * sap_acs_subch_run() - Count the 20 MHz spaced entries from an entry on
+ * @spect_ch: spectrum channel array
+ * @idx: index of the first entry
+ * @num_ch: number of entries in @spect_ch
+ * @num_subch: number of sub channels of the bonded width, the count is
+ *	       capped at it
  *
- * Return: none
+ * Return: length of the run starting at @idx, at most @num_subch
  */
-static void sap_sort_chl_weight_80_mhz(struct mac_context *mac_ctx,
-				       tSapChSelSpectInfo *pSpectInfoParams)
+static uint32_t sap_acs_subch_run(tSapSpectChInfo *spect_ch, uint32_t idx,
+				  uint32_t num_ch, uint8_t num_subch)
 {
-	uint8_t i, j;
-	tSapSpectChInfo *pSpectInfo;
-	uint8_t minIdx;
-	struct ch_params acs_ch_params;
-	int8_t center_freq_diff;
-	uint32_t combined_weight;
-	uint32_t min_ch_weight;
+	uint32_t run = 1;
 
-	pSpectInfo = pSpectInfoParams->pSpectCh;
+	while (run < num_subch && idx + run < num_ch &&
+	       spect_ch[idx + run - 1].chan_freq + 20 ==
+	       spect_ch[idx + run].chan_freq)
+		run++;
 
-	for (j = 0; j < pSpectInfoParams->numSpectChans; j++) {
-
-		if (pSpectInfo[j].weight_calc_done)
-			continue;
-
-		acs_ch_params.ch_width = CH_WIDTH_80MHZ;
-
-		wlan_reg_set_channel_params_for_freq(mac_ctx->pdev,
-						     pSpectInfo[j].chan_freq,
-						     0, &acs_ch_params);
-
-		/* Check if the freq supports 80 Mhz */
-		if (acs_ch_params.ch_width != CH_WIDTH_80MHZ) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 4;
-			pSpectInfo[j].weight_calc_done = true;
-			continue;
-		}
-
-		center_freq_diff = acs_ch_params.mhz_freq_seg0 -
-				   pSpectInfo[j].chan_freq;
-
-		/* This channel frequency does not have all channels */
-		if (center_freq_diff != 30) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 4;
-			pSpectInfo[j].weight_calc_done = true;
-			continue;
-		}
-
-		/* no other freq left for 80 Mhz operation in spectrum */
-		if (j + 3 > pSpectInfoParams->numSpectChans)
-			continue;
-
-		/* Check whether all frequencies are present for 80 Mhz */
-
-		if (!(((pSpectInfo[j].chan_freq + 20) ==
-			pSpectInfo[j + 1].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 40) ==
-				 pSpectInfo[j + 2].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 60) ==
-				 pSpectInfo[j + 3].chan_freq))) {
-			/*
-			 * some channels does not exist in pSectInfo array,
-			 * skip this channel and those in the same HT80 width
-			 */
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 4;
-			pSpectInfo[j].weight_calc_done = true;
-			if ((pSpectInfo[j].chan_freq + 20) ==
-					pSpectInfo[j + 1].chan_freq) {
-				pSpectInfo[j + 1].weight =
-					SAP_ACS_WEIGHT_MAX * 4;
-				pSpectInfo[j +1].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 40) ==
-					pSpectInfo[j + 2].chan_freq) {
-				pSpectInfo[j + 2].weight =
-					SAP_ACS_WEIGHT_MAX * 4;
-				pSpectInfo[j +2].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 60) ==
-					pSpectInfo[j + 3].chan_freq) {
-				pSpectInfo[j + 3].weight =
-					SAP_ACS_WEIGHT_MAX * 4;
-				pSpectInfo[j +3].weight_calc_done = true;
-			}
-
-			continue;
-		}
-
-		/* We have 4 channels to calculate cumulative weight */
-
-		combined_weight = pSpectInfo[j].weight +
-				  pSpectInfo[j + 1].weight +
-				  pSpectInfo[j + 2].weight +
-				  pSpectInfo[j + 3].weight;
-
-		min_ch_weight = pSpectInfo[j].weight;
-		minIdx = 0;
-
-		for (i = 0; i < 4; i++) {
-			if (min_ch_weight > pSpectInfo[j + i].weight) {
-				min_ch_weight = pSpectInfo[j + i].weight;
-				minIdx = i;
-			}
-			pSpectInfo[j + i].weight = SAP_ACS_WEIGHT_MAX * 4;
-			pSpectInfo[j + i].weight_calc_done = true;
-		}
-
-		pSpectInfo[j + minIdx].weight = combined_weight;
-
-		sap_debug("best freq = %d for 80mhz center freq %d combined weight = %d",
-			  pSpectInfo[j + minIdx].chan_freq,
-			  acs_ch_params.mhz_freq_seg0,
-			  combined_weight);
-	}
-
-	sap_sort_chl_weight(pSpectInfoParams);
-
-	pSpectInfo = pSpectInfoParams->pSpectCh;
-
-	for (j = 0; j < (pSpectInfoParams->numSpectChans); j++) {
-		sap_debug_rl("freq = %d weight = %d rssi = %d bss count = %d",
-			     pSpectInfo->chan_freq, pSpectInfo->weight,
-			     pSpectInfo->rssiAgr, pSpectInfo->bssCount);
-
-		pSpectInfo++;
-	}
+	return run;
 }
 
 /**
- * sap_sort_chl_weight_vht160() - to sort the channels with the least weight
+ * sap_sort_chl_weight_wide() - to sort the channels with the least weight
+ * for a bonded channel width
+ * @mac_ctx: Pointer to mac context
  * @pSpectInfoParams: Pointer to the tSapChSelSpectInfo structure
+ * @ch_width: bonded channel width to score the spectrum for
+ * @num_subch: number of 20 MHz sub channels in @ch_width
  *
- * Function to sort the channels with the least weight first for VHT160 channels
+ * The spectrum is walked once. A prefix sum of the 20 MHz weights and the
+ * length of the run of 20 MHz spaced channels starting at every entry
+ * (capped at @num_subch) are built first, so the combined weight and the
+ * "all sub channels present" check of a bonded channel are O(1) per
+ * candidate instead of an unrolled per width comparison. If these tables
+ * cannot be allocated, both are computed per candidate block instead.
+ * The least weighted sub channel of every complete bonded channel carries
+ * the combined weight, all other sub channels get
+ * SAP_ACS_WEIGHT_MAX * @num_subch so that they are sorted to the bottom.
  *
  * Return: none
  */
-static void sap_sort_chl_weight_160_mhz(struct mac_context *mac_ctx,
-					tSapChSelSpectInfo *pSpectInfoParams)
+static void sap_sort_chl_weight_wide(struct mac_context *mac_ctx,
+				     tSapChSelSpectInfo *pSpectInfoParams,
+				     enum phy_ch_width ch_width,
+				     uint8_t num_subch)
 {
-	uint8_t i, j;
 	tSapSpectChInfo *pSpectInfo;
-	uint8_t minIdx;
+	uint32_t num_ch = pSpectInfoParams->numSpectChans;
+	uint32_t max_weight = SAP_ACS_WEIGHT_MAX * num_subch;
+	uint32_t *weight_sum;
+	uint8_t *run_len;
 	struct ch_params acs_ch_params;
-	int8_t center_freq_diff;
+	uint32_t i, j, min_idx, run;
+	uint32_t center_freq;
 	uint32_t combined_weight;
-	uint32_t min_ch_weight;
 
 	pSpectInfo = pSpectInfoParams->pSpectCh;
+	if (!num_ch)
+		return;
 
-	for (j = 0; j < pSpectInfoParams->numSpectChans; j++) {
-
-		if (pSpectInfo[j].weight_calc_done)
-			continue;
-
-		acs_ch_params.ch_width = CH_WIDTH_160MHZ;
-
-		wlan_reg_set_channel_params_for_freq(mac_ctx->pdev,
-						     pSpectInfo[j].chan_freq,
-						     0, &acs_ch_params);
-
-		/* Check if the freq supports 160 Mhz */
-		if (acs_ch_params.ch_width != CH_WIDTH_160MHZ) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 8;
-			pSpectInfo[j].weight_calc_done = true;
-			continue;
-		}
-
-		center_freq_diff = acs_ch_params.mhz_freq_seg1 -
-				   pSpectInfo[j].chan_freq;
-
-		/* This channel frequency does not have all channels */
-		if (center_freq_diff != 70) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 8;
-			pSpectInfo[j].weight_calc_done = true;
-			continue;
-		}
-
-		/* no other freq left for 160 Mhz operation in spectrum */
-		if (j + 7 > pSpectInfoParams->numSpectChans)
-			continue;
-
-		/* Check whether all frequencies are present for 160 Mhz */
-
-		if (!(((pSpectInfo[j].chan_freq + 20) ==
-			pSpectInfo[j + 1].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 40) ==
-				 pSpectInfo[j + 2].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 60) ==
-				 pSpectInfo[j + 3].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 80) ==
-				 pSpectInfo[j + 4].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 100) ==
-				 pSpectInfo[j + 5].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 120) ==
-				 pSpectInfo[j + 6].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 140) ==
-				 pSpectInfo[j + 7].chan_freq))) {
-			/*
-			 * some channels does not exist in pSectInfo array,
-			 * skip this channel and those in the same VHT160 width
-			 */
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 8;
-			pSpectInfo[j].weight_calc_done = true;
-			if ((pSpectInfo[j].chan_freq + 20) ==
-					pSpectInfo[j + 1].chan_freq) {
-				pSpectInfo[j + 1].weight =
-					SAP_ACS_WEIGHT_MAX * 8;
-				pSpectInfo[j + 1].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 40) ==
-					pSpectInfo[j + 2].chan_freq) {
-				pSpectInfo[j + 2].weight =
-					SAP_ACS_WEIGHT_MAX * 8;
-				pSpectInfo[j + 2].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 60) ==
-					pSpectInfo[j + 3].chan_freq) {
-				pSpectInfo[j + 3].weight =
-					SAP_ACS_WEIGHT_MAX * 8;
-				pSpectInfo[j + 3].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 80) ==
-					pSpectInfo[j + 4].chan_freq) {
-				pSpectInfo[j + 4].weight =
-					SAP_ACS_WEIGHT_MAX * 8;
-				pSpectInfo[j + 4].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 100) ==
-					pSpectInfo[j + 5].chan_freq) {
-				pSpectInfo[j + 5].weight =
-					SAP_ACS_WEIGHT_MAX * 8;
-				pSpectInfo[j + 5].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 120) ==
-					pSpectInfo[j + 6].chan_freq) {
-				pSpectInfo[j + 6].weight =
-					SAP_ACS_WEIGHT_MAX * 8;
-				pSpectInfo[j + 6].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 140) ==
-					pSpectInfo[j + 7].chan_freq) {
-				pSpectInfo[j + 7].weight =
-					SAP_ACS_WEIGHT_MAX * 8;
-				pSpectInfo[j + 7].weight_calc_done = true;
-			}
-
-			continue;
-		}
-
-
-		/* We have 8 channels to calculate cumulative weight */
-
-		combined_weight = pSpectInfo[j].weight +
-				  pSpectInfo[j + 1].weight +
-				  pSpectInfo[j + 2].weight +
-				  pSpectInfo[j + 3].weight +
-				  pSpectInfo[j + 4].weight +
-				  pSpectInfo[j + 5].weight +
-				  pSpectInfo[j + 6].weight +
-				  pSpectInfo[j + 7].weight;
-
-		min_ch_weight = pSpectInfo[j].weight;
-		minIdx = 0;
+	weight_sum = qdf_mem_malloc((num_ch + 1) * sizeof(*weight_sum));
+	run_len = qdf_mem_malloc(num_ch * sizeof(*run_len));
+	if (!weight_sum || !run_len) {
+		sap_err("no memory for %dmhz tables, scoring per block",
+			num_subch * 20);
+		qdf_mem_free(run_len);
+		qdf_mem_free(weight_sum);
+		run_len = NULL;
+		weight_sum = NULL;
+	} else {
+		/* weight_sum[j] is the sum of the weights of entries [0, j) */
+		for (j = 0; j < num_ch; j++)
+			weight_sum[j + 1] = weight_sum[j] +
+					    pSpectInfo[j].weight;
 
-		for (i = 0; i < 8; i++) {
-			if (min_ch_weight > pSpectInfo[j + i].weight) {
-				min_ch_weight = pSpectInfo[j + i].weight;
-				minIdx = i;
-			}
-			pSpectInfo[j + i].weight = SAP_ACS_WEIGHT_MAX * 8;
-			pSpectInfo[j + i].weight_calc_done = true;
+		/*
+		 * run_len[j] is the number of 20 MHz spaced entries from
+		 * entry j on, saturated at num_subch so that every offset of
+		 * a long run, not only the ones aligned to its end, can start
+		 * a complete bonded channel.
+		 */
+		run_len[num_ch - 1] = 1;
+		for (j = num_ch - 1; j > 0; j--) {
+			if (pSpectInfo[j - 1].chan_freq + 20 ==
+			    pSpectInfo[j].chan_freq)
+				run_len[j - 1] = qdf_min_t(uint8_t,
+							   run_len[j] + 1,
+							   num_subch);
+			else
+				run_len[j - 1] = 1;
 		}
-
-		pSpectInfo[j + minIdx].weight = combined_weight;
-
-		sap_debug("best freq = %d for 160mhz center freq %d combined weight = %d",
-			  pSpectInfo[j + minIdx].chan_freq,
-			  acs_ch_params.mhz_freq_seg1,
-			  combined_weight);
 	}
 
-	sap_sort_chl_weight(pSpectInfoParams);
-
-	pSpectInfo = pSpectInfoParams->pSpectCh;
-	for (j = 0; j < (pSpectInfoParams->numSpectChans); j++) {
-		sap_debug_rl("freq = %d weight = %d rssi = %d bss count = %d",
-			     pSpectInfo->chan_freq, pSpectInfo->weight,
-			     pSpectInfo->rssiAgr, pSpectInfo->bssCount);
-
-		pSpectInfo++;
-	}
-}
-
-#ifdef WLAN_FEATURE_11BE
-/**
- * sap_sort_chl_weight_320_mhz() - to sort the channels with the least weight
- * @pSpectInfoParams: Pointer to the tSapChSelSpectInfo structure
- *
- * Function to sort the channels with the least weight first for 320MHz channels
- *
- * Return: none
- */
-static void sap_sort_chl_weight_320_mhz(struct mac_context *mac_ctx,
-					tSapChSelSpectInfo *pSpectInfoParams)
-{
-	uint8_t i, j;
-	tSapSpectChInfo *pSpectInfo;
-	uint8_t minIdx;
-	struct ch_params acs_ch_params;
-	int8_t center_freq_diff;
-	uint32_t combined_weight;
-	uint32_t min_ch_weight;
-
-	pSpectInfo = pSpectInfoParams->pSpectCh;
-
-	for (j = 0; j < pSpectInfoParams->numSpectChans; j++) {
+	for (j = 0; j < num_ch; j++) {
 		if (pSpectInfo[j].weight_calc_done)
 			continue;
 
-		acs_ch_params.ch_width = CH_WIDTH_320MHZ;
+		if (ch_width == CH_WIDTH_40MHZ &&
+		    WLAN_REG_IS_24GHZ_CH_FREQ(pSpectInfo[j].chan_freq))
+			continue;
 
+		acs_ch_params.ch_width = ch_width;
 		wlan_reg_set_channel_params_for_freq(mac_ctx->pdev,
 						     pSpectInfo[j].chan_freq,
 						     0, &acs_ch_params);
 
-		/* Check if the freq supports 320 Mhz */
-		if (acs_ch_params.ch_width != CH_WIDTH_320MHZ) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 16;
+		/* Check if the freq supports the bonded width */
+		if (acs_ch_params.ch_width != ch_width) {
+			pSpectInfo[j].weight = max_weight;
 			pSpectInfo[j].weight_calc_done = true;
 			continue;
 		}
 
-		center_freq_diff = acs_ch_params.mhz_freq_seg1 -
-				   pSpectInfo[j].chan_freq;
+		/* 160 and 320 MHz report the full width center in seg1 */
+		if (ch_width == CH_WIDTH_40MHZ || ch_width == CH_WIDTH_80MHZ)
+			center_freq = acs_ch_params.mhz_freq_seg0;
+		else
+			center_freq = acs_ch_params.mhz_freq_seg1;
 
-		/* This channel frequency does not have all channels */
-		if (center_freq_diff != 150) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 16;
+		/* This channel frequency is not the lowest sub channel */
+		if (center_freq != pSpectInfo[j].chan_freq +
+				   (num_subch - 1) * 10) {
+			pSpectInfo[j].weight = max_weight;
 			pSpectInfo[j].weight_calc_done = true;
 			continue;
 		}
 
-		/* no other freq left for 320 Mhz operation in spectrum */
-		if (j + 15 > pSpectInfoParams->numSpectChans)
-			continue;
-
-		/* Check whether all frequencies are present for 160 Mhz */
-
-		if (!(((pSpectInfo[j].chan_freq + 20) ==
-			pSpectInfo[j + 1].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 40) ==
-				 pSpectInfo[j + 2].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 60) ==
-				 pSpectInfo[j + 3].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 80) ==
-				 pSpectInfo[j + 4].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 100) ==
-				 pSpectInfo[j + 5].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 120) ==
-				 pSpectInfo[j + 6].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 140) ==
-				 pSpectInfo[j + 7].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 160) ==
-				 pSpectInfo[j + 8].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 180) ==
-				 pSpectInfo[j + 9].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 200) ==
-				 pSpectInfo[j + 10].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 220) ==
-				 pSpectInfo[j + 11].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 240) ==
-				 pSpectInfo[j + 12].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 260) ==
-				 pSpectInfo[j + 13].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 280) ==
-				 pSpectInfo[j + 14].chan_freq) &&
-			((pSpectInfo[j].chan_freq + 300) ==
-				 pSpectInfo[j + 15].chan_freq))) {
-			/*
-			 * some channels does not exist in pSectInfo array,
-			 * skip this channel and those in the same ETH320 width
-			 */
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 16;
-			pSpectInfo[j].weight_calc_done = true;
-			if ((pSpectInfo[j].chan_freq + 20) ==
-					pSpectInfo[j + 1].chan_freq) {
-				pSpectInfo[j + 1].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 1].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 40) ==
-					pSpectInfo[j + 2].chan_freq) {
-				pSpectInfo[j + 2].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 2].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 60) ==
-					pSpectInfo[j + 3].chan_freq) {
-				pSpectInfo[j + 3].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 3].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 80) ==
-					pSpectInfo[j + 4].chan_freq) {
-				pSpectInfo[j + 4].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 4].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 100) ==
-					pSpectInfo[j + 5].chan_freq) {
-				pSpectInfo[j + 5].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 5].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 120) ==
-					pSpectInfo[j + 6].chan_freq) {
-				pSpectInfo[j + 6].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 6].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 140) ==
-					pSpectInfo[j + 7].chan_freq) {
-				pSpectInfo[j + 7].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 7].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 160) ==
-					pSpectInfo[j + 8].chan_freq) {
-				pSpectInfo[j + 8].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 8].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 180) ==
-					pSpectInfo[j + 9].chan_freq) {
-				pSpectInfo[j + 9].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 9].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 200) ==
-					pSpectInfo[j + 10].chan_freq) {
-				pSpectInfo[j + 10].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 10].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 220) ==
-					pSpectInfo[j + 11].chan_freq) {
-				pSpectInfo[j + 11].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 11].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 240) ==
-					pSpectInfo[j + 12].chan_freq) {
-				pSpectInfo[j + 12].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 12].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 260) ==
-					pSpectInfo[j + 13].chan_freq) {
-				pSpectInfo[j + 13].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 13].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 280) ==
-					pSpectInfo[j + 14].chan_freq) {
-				pSpectInfo[j + 14].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 14].weight_calc_done = true;
-			}
-			if ((pSpectInfo[j].chan_freq + 300) ==
-					pSpectInfo[j + 15].chan_freq) {
-				pSpectInfo[j + 15].weight =
-					SAP_ACS_WEIGHT_MAX * 16;
-				pSpectInfo[j + 15].weight_calc_done = true;
+		/*
+		 * some sub channels do not exist in pSpectInfo array, skip
+		 * this channel and those present in the same bonded width
+		 */
+		if (run_len)
+			run = run_len[j];
+		else
+			run = sap_acs_subch_run(pSpectInfo, j, num_ch,
+						num_subch);
+		if (run < num_subch) {
+			for (i = 0; i < run; i++) {
+				pSpectInfo[j + i].weight = max_weight;
+				pSpectInfo[j + i].weight_calc_done = true;
 			}
-
 			continue;
 		}
 
-		/* We have 16 channels to calculate cumulative weight */
-		combined_weight = pSpectInfo[j].weight +
-				  pSpectInfo[j + 1].weight +
-				  pSpectInfo[j + 2].weight +
-				  pSpectInfo[j + 3].weight +
-				  pSpectInfo[j + 4].weight +
-				  pSpectInfo[j + 5].weight +
-				  pSpectInfo[j + 6].weight +
-				  pSpectInfo[j + 7].weight +
-				  pSpectInfo[j + 8].weight +
-				  pSpectInfo[j + 9].weight +
-				  pSpectInfo[j + 10].weight +
-				  pSpectInfo[j + 11].weight +
-				  pSpectInfo[j + 12].weight +
-				  pSpectInfo[j + 13].weight +
-				  pSpectInfo[j + 14].weight +
-				  pSpectInfo[j + 15].weight;
-
-		min_ch_weight = pSpectInfo[j].weight;
-		minIdx = 0;
-
-		for (i = 0; i < 16; i++) {
-			if (min_ch_weight > pSpectInfo[j + i].weight) {
-				min_ch_weight = pSpectInfo[j + i].weight;
-				minIdx = i;
-			}
-			pSpectInfo[j + i].weight = SAP_ACS_WEIGHT_MAX * 16;
-			pSpectInfo[j + i].weight_calc_done = true;
+		if (weight_sum)
+			combined_weight = weight_sum[j + num_subch] -
+					  weight_sum[j];
+		else
+			combined_weight = 0;
+
+		min_idx = j;
+		for (i = j; i < j + num_subch; i++) {
+			if (!weight_sum)
+				combined_weight += pSpectInfo[i].weight;
+			if (pSpectInfo[i].weight < pSpectInfo[min_idx].weight)
+				min_idx = i;
 		}
+		for (i = j; i < j + num_subch; i++) {
+			if (i != min_idx)
+				pSpectInfo[i].weight = max_weight;
+			pSpectInfo[i].weight_calc_done = true;
+		}
+		pSpectInfo[min_idx].weight = combined_weight;
 
-		pSpectInfo[j + minIdx].weight = combined_weight;
-
-		sap_debug("best freq = %d for 320mhz center freq %d combined weight = %d",
-			  pSpectInfo[j + minIdx].chan_freq,
-			  acs_ch_params.mhz_freq_seg1,
-			  combined_weight);
+		sap_debug("best freq = %d for %dmhz center freq %d combined weight = %d",
+			  pSpectInfo[min_idx].chan_freq, num_subch * 20,
+			  center_freq, combined_weight);
 	}
 
+	qdf_mem_free(run_len);
+	qdf_mem_free(weight_sum);
+
 	sap_sort_chl_weight(pSpectInfoParams);
 
 	pSpectInfo = pSpectInfoParams->pSpectCh;
-	for (j = 0; j < (pSpectInfoParams->numSpectChans); j++) {
+	for (j = 0; j < num_ch; j++) {
 		sap_debug_rl("freq = %d weight = %d rssi = %d bss count = %d",
 			     pSpectInfo->chan_freq, pSpectInfo->weight,
 			     pSpectInfo->rssiAgr, pSpectInfo->bssCount);
@@ -2060,7 +1984,6 @@ static void sap_sort_chl_weight_320_mhz(struct mac_context *mac_ctx,
 		pSpectInfo++;
 	}
 }
-#endif /* WLAN_FEATURE_11BE */
 
 /**
  * sap_allocate_max_weight_ht40_24_g() - allocate max weight for 40Mhz
@@ -2257,112 +2180,6 @@ static void sap_sort_chl_weight_ht40_24_g(struct mac_context *mac_ctx,
 	sap_sort_chl_weight(pSpectInfoParams);
 }
 
-static void sap_sort_chl_weight_40_mhz(struct mac_context *mac_ctx,
-				       tSapChSelSpectInfo *pSpectInfoParams)
-{
-	uint8_t i, j;
-	tSapSpectChInfo *pSpectInfo;
-	uint8_t minIdx;
-	struct ch_params acs_ch_params;
-	int8_t center_freq_diff;
-	uint32_t combined_weight;
-	uint32_t min_ch_weight;
-
-	pSpectInfo = pSpectInfoParams->pSpectCh;
-
-	for (j = 0; j < pSpectInfoParams->numSpectChans; j++) {
-
-		if (WLAN_REG_IS_24GHZ_CH_FREQ(pSpectInfo[j].chan_freq))
-			continue;
-
-		if (pSpectInfo[j].weight_calc_done)
-			continue;
-
-		acs_ch_params.ch_width = CH_WIDTH_40MHZ;
-
-		wlan_reg_set_channel_params_for_freq(mac_ctx->pdev,
-						     pSpectInfo[j].chan_freq,
-						     0, &acs_ch_params);
-
-		/* Check if the freq supports 40 Mhz */
-		if (acs_ch_params.ch_width != CH_WIDTH_40MHZ) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 2;
-			pSpectInfo[j].weight_calc_done = true;
-			continue;
-		}
-
-		center_freq_diff = acs_ch_params.mhz_freq_seg0 -
-				   pSpectInfo[j].chan_freq;
-
-		/* This channel frequency does not have all channels */
-		if (center_freq_diff != 10) {
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 2;
-			pSpectInfo[j].weight_calc_done = true;
-			continue;
-		}
-
-		/* no other freq left for 40 Mhz operation in spectrum */
-		if (j + 1 > pSpectInfoParams->numSpectChans)
-			continue;
-
-		/* Check whether all frequencies are present for 40 Mhz */
-
-		if (!((pSpectInfo[j].chan_freq + 20) ==
-		       pSpectInfo[j + 1].chan_freq)) {
-			/*
-			 * some channels does not exist in pSectInfo array,
-			 * skip this channel and those in the same 40 width
-			 */
-			pSpectInfo[j].weight = SAP_ACS_WEIGHT_MAX * 2;
-			pSpectInfo[j].weight_calc_done = true;
-
-			if ((pSpectInfo[j].chan_freq + 20) ==
-					pSpectInfo[j + 1].chan_freq) {
-				pSpectInfo[j + 1].weight =
-					SAP_ACS_WEIGHT_MAX * 2;
-				pSpectInfo[j +1].weight_calc_done = true;
-			}
-
-			continue;
-		}
-
-		/* We have 2 channels to calculate cumulative weight */
-
-		combined_weight = pSpectInfo[j].weight +
-				  pSpectInfo[j + 1].weight;
-
-		min_ch_weight = pSpectInfo[j].weight;
-		minIdx = 0;
-
-		for (i = 0; i < 2; i++) {
-			if (min_ch_weight > pSpectInfo[j + i].weight) {
-				min_ch_weight = pSpectInfo[j + i].weight;
-				minIdx = i;
-			}
-			pSpectInfo[j + i].weight = SAP_ACS_WEIGHT_MAX * 2;
-			pSpectInfo[j + i].weight_calc_done = true;
-		}
-
-		pSpectInfo[j + minIdx].weight = combined_weight;
-
-		sap_debug("best freq = %d for 40mhz center freq %d combined weight = %d",
-			  pSpectInfo[j + minIdx].chan_freq,
-			  acs_ch_params.mhz_freq_seg0,
-			  combined_weight);
-	}
-
-	sap_sort_chl_weight(pSpectInfoParams);
-
-	pSpectInfo = pSpectInfoParams->pSpectCh;
-	for (j = 0; j < (pSpectInfoParams->numSpectChans); j++) {
-		sap_debug_rl("freq = %d weight = %d rssi = %d bss count = %d",
-			     pSpectInfo->chan_freq, pSpectInfo->weight,
-			     pSpectInfo->rssiAgr, pSpectInfo->bssCount);
-
-		pSpectInfo++;
-	}
-}
-
 /*==========================================================================
    FUNCTION    sap_sort_chl_weight_all
 
@@ -2408,19 +2225,23 @@ static void sap_sort_chl_weight_all(struct mac_context *mac_ctx,
 						      domain);
 		} else {
 			sap_allocate_max_weight_40_mhz_24_g(pSpectInfoParams);
-			sap_sort_chl_weight_40_mhz(mac_ctx, pSpectInfoParams);
+			sap_sort_chl_weight_wide(mac_ctx, pSpectInfoParams,
+						 CH_WIDTH_40MHZ, 2);
 		}
 		break;
 	case CH_WIDTH_80MHZ:
 	case CH_WIDTH_80P80MHZ:
-		sap_sort_chl_weight_80_mhz(mac_ctx, pSpectInfoParams);
+		sap_sort_chl_weight_wide(mac_ctx, pSpectInfoParams,
+					 CH_WIDTH_80MHZ, 4);
 		break;
 	case CH_WIDTH_160MHZ:
-		sap_sort_chl_weight_160_mhz(mac_ctx, pSpectInfoParams);
+		sap_sort_chl_weight_wide(mac_ctx, pSpectInfoParams,
+					 CH_WIDTH_160MHZ, 8);
 		break;
 #ifdef WLAN_FEATURE_11BE
 	case CH_WIDTH_320MHZ:
-		sap_sort_chl_weight_320_mhz(mac_ctx, pSpectInfoParams);
+		sap_sort_chl_weight_wide(mac_ctx, pSpectInfoParams,
+					 CH_WIDTH_320MHZ, 16);
 		break;
 #endif
 	case CH_WIDTH_20MHZ:
@@ -2483,7 +2304,8 @@ uint32_t sap_select_channel(mac_handle_t mac_handle,
 	}
 
 	/* Compute the weight of the entire spectrum in the operating band */
-	sap_compute_spect_weight(spect_info, mac_handle, scan_list, sap_ctx);
+	sap_compute_spect_weight_cached(spect_info, mac_handle, scan_list,
+					sap_ctx);
 
 #ifdef FEATURE_AP_MCC_CH_AVOIDANCE
 	/* process avoid channel IE to collect all channels to avoid */
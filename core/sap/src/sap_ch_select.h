@@ -122,4 +122,22 @@ typedef struct {
 	uint8_t numSpectChans;  /* Total num of channels in the spectrum */
 } tSapChSelSpectInfo;           /* tDfsChSelParams; */
 
+/**
+ * struct sap_acs_spect_cache - spectrum weights of the last ACS run
+ * @spect_ch: per channel weights as computed from the scan results
+ * @ch_flags: per channel SAP_ACS_CACHE_CH_* inputs the weights depend on
+ * @num_ch: number of entries in @spect_ch and @ch_flags
+ * @num_entries: number of scan entries the weights were computed from
+ * @newest_entry_time: scan_entry_time of the newest of those scan entries
+ * @timestamp: system time in ms at which the weights were computed
+ */
+struct sap_acs_spect_cache {
+	tSapSpectChInfo *spect_ch;
+	uint8_t *ch_flags;
+	uint8_t num_ch;
+	uint32_t num_entries;
+	qdf_time_t newest_entry_time;
+	qdf_time_t timestamp;
+};
+
 #endif /* if !defined __SAP_CH_SELECT_H */
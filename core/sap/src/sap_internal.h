@@ -182,6 +182,7 @@ struct sap_context {
 	struct sap_acs_cfg *acs_cfg;
 
 	qdf_time_t acs_req_timestamp;
+	struct sap_acs_spect_cache acs_spect_cache;
 
 #ifdef FEATURE_WLAN_MCC_TO_SCC_SWITCH
 	uint8_t cc_switch_mode;
@@ -301,6 +302,14 @@ QDF_STATUS wlansap_pre_start_bss_acs_scan_callback(mac_handle_t mac_handle,
 uint32_t sap_select_channel(mac_handle_t mac_handle, struct sap_context *sap_ctx,
 			   qdf_list_t *scan_list);
 
+/**
+ * sap_acs_cache_flush() - drop the cached ACS spectrum weights
+ * @sap_ctx: Sap context
+ *
+ * Return: None
+ */
+void sap_acs_cache_flush(struct sap_context *sap_ctx);
+
 QDF_STATUS
 sap_signal_hdd_event(struct sap_context *sap_ctx,
 		  struct csr_roam_info *pCsrRoamInfo,
@@ -377,6 +377,7 @@ QDF_STATUS sap_deinit_ctx(struct sap_context *sap_ctx)
 		sap_ctx->freq_list = NULL;
 		sap_ctx->num_of_channel = 0;
 	}
+	sap_acs_cache_flush(sap_ctx);
 	sap_free_roam_profile(&sap_ctx->csr_roamProfile);
 	if (sap_ctx->sessionId != WLAN_UMAC_VDEV_ID_MAX) {
 		/* empty queues/lists/pkts if any */